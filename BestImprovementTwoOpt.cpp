@@ -0,0 +1,239 @@
+#include "BestImprovementTwoOpt.h"
+#include "DistancePolicy.h"
+#include "Parallel.h"
+#include "Stats.h"
+
+#include <algorithm> // Pour std::sort, std::min
+#include <climits>   // Pour INT_MAX
+#include <cstdint>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#define TSP_HAVE_AVX2_KERNEL 1
+#endif
+
+// Lignes i évaluées par tâche de la réduction parallèle (répartition dynamique :
+// les premières lignes, plus longues, ne pénalisent pas un thread en particulier)
+static const int kRowsPerTask = 16;
+
+// Au-delà, l'indice a * N + c d'un poids de la matrice ne tient plus sur 32 bits
+static const int kVectorDimensionLimit = 46340;
+
+namespace {
+
+// Meilleur j d'une ligne : valeur minimale de d(a, c) + d(b, d) - d(c, d), j = -1 si la
+// ligne est vide. À valeur égale, le plus petit j (même choix pour les deux noyaux).
+struct RowBest {
+    int value;
+    int j;
+};
+
+// Noyau scalaire, pour toute politique de distance
+template <typename Distance>
+RowBest scanRowScalar(const Distance& dist, int a, int b, const int* nodes, const int* edges, int j, int end) {
+    RowBest best{INT_MAX, -1};
+    for (; j < end; ++j) {
+        int value = dist(a, nodes[j]) + dist(b, nodes[j + 1]) - edges[j];
+        if (value < best.value) {
+            best.value = value;
+            best.j = j;
+        }
+    }
+    return best;
+}
+
+#ifdef TSP_HAVE_AVX2_KERNEL
+// Rassemble 8 poids de la matrice. Les poids de 8 et 16 bits sont extraits des mots de
+// 32 bits alignés qui les contiennent : une lecture alignée ne déborde jamais de la page
+// du dernier poids, même en fin de tableau.
+__attribute__((target("avx2")))
+inline __m256i gatherWeights(const int* data, __m256i index) {
+    return _mm256_i32gather_epi32(data, index, 4);
+}
+
+__attribute__((target("avx2")))
+inline __m256i gatherWeights(const std::uint16_t* data, __m256i index) {
+    __m256i words = _mm256_i32gather_epi32(reinterpret_cast<const int*>(data), _mm256_srli_epi32(index, 1), 4);
+    __m256i shift = _mm256_slli_epi32(_mm256_and_si256(index, _mm256_set1_epi32(1)), 4);
+    return _mm256_and_si256(_mm256_srlv_epi32(words, shift), _mm256_set1_epi32(0xFFFF));
+}
+
+__attribute__((target("avx2")))
+inline __m256i gatherWeights(const std::uint8_t* data, __m256i index) {
+    __m256i words = _mm256_i32gather_epi32(reinterpret_cast<const int*>(data), _mm256_srli_epi32(index, 2), 4);
+    __m256i shift = _mm256_slli_epi32(_mm256_and_si256(index, _mm256_set1_epi32(3)), 3);
+    return _mm256_and_si256(_mm256_srlv_epi32(words, shift), _mm256_set1_epi32(0xFF));
+}
+
+// Noyau AVX2 sur la matrice complète : 8 valeurs de j par itération, minimum et indice
+// gardés par voie, réduits en fin de ligne ; le reste de la ligne est scalaire
+template <typename Weight>
+__attribute__((target("avx2")))
+RowBest scanRowAvx2(const Weight* data, int n, int a, int b, const int* nodes, const int* edges, int j, int end) {
+    const __m256i row_a = _mm256_set1_epi32(a * n);
+    const __m256i row_b = _mm256_set1_epi32(b * n);
+    const __m256i eight = _mm256_set1_epi32(8);
+    __m256i js = _mm256_add_epi32(_mm256_set1_epi32(j), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    __m256i best_value = _mm256_set1_epi32(INT_MAX);
+    __m256i best_j = _mm256_set1_epi32(-1);
+    for (; j + 8 <= end; j += 8) {
+        __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(nodes + j));
+        __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(nodes + j + 1));
+        __m256i cd = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(edges + j));
+        __m256i value = _mm256_sub_epi32(_mm256_add_epi32(gatherWeights(data, _mm256_add_epi32(row_a, c)),
+                                                          gatherWeights(data, _mm256_add_epi32(row_b, d))),
+                                         cd);
+        // Strictement meilleur : chaque voie garde son plus petit j
+        __m256i better = _mm256_cmpgt_epi32(best_value, value);
+        best_value = _mm256_blendv_epi8(best_value, value, better);
+        best_j = _mm256_blendv_epi8(best_j, js, better);
+        js = _mm256_add_epi32(js, eight);
+    }
+    alignas(32) int values[8];
+    alignas(32) int indices[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(values), best_value);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(indices), best_j);
+    RowBest best{INT_MAX, -1};
+    for (int lane = 0; lane < 8; ++lane) {
+        if (indices[lane] >= 0 &&
+            (values[lane] < best.value || (values[lane] == best.value && indices[lane] < best.j))) {
+            best.value = values[lane];
+            best.j = indices[lane];
+        }
+    }
+    const Weight* from_a = data + static_cast<std::size_t>(a) * n;
+    const Weight* from_b = data + static_cast<std::size_t>(b) * n;
+    for (; j < end; ++j) {
+        int value = static_cast<int>(from_a[nodes[j]]) + static_cast<int>(from_b[nodes[j + 1]]) - edges[j];
+        if (value < best.value) {
+            best.value = value;
+            best.j = j;
+        }
+    }
+    return best;
+}
+
+// Aiguillage selon le type de poids de la matrice
+RowBest scanRowVector(const Graph& graph, int a, int b, const int* nodes, const int* edges, int j, int end) {
+    int n = graph.getDimension();
+    switch (graph.getWeightType()) {
+    case WeightType::UInt16:
+        return scanRowAvx2(static_cast<const std::uint16_t*>(graph.getDistanceData()), n, a, b, nodes, edges, j, end);
+    case WeightType::UInt8:
+        return scanRowAvx2(static_cast<const std::uint8_t*>(graph.getDistanceData()), n, a, b, nodes, edges, j, end);
+    default:
+        return scanRowAvx2(static_cast<const int*>(graph.getDistanceData()), n, a, b, nodes, edges, j, end);
+    }
+}
+#endif
+
+} // namespace
+
+// Constructeur
+BestImprovementTwoOpt::BestImprovementTwoOpt(const Graph& graph)
+    : graph_(graph), threadCount_(hardwareThreads()) {}
+
+// Vrai si le noyau AVX2 s'applique : matrice complète adressable sur 32 bits, alignée
+// pour les lectures de mots, et processeur compatible
+bool BestImprovementTwoOpt::hasVectorKernel() const {
+#ifdef TSP_HAVE_AVX2_KERNEL
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    return vectorKernel_ && has_avx2 && graph_.getDistanceMode() == DistanceMode::Matrix &&
+           graph_.getLayout() == MatrixLayout::Full && graph_.getDimension() <= kVectorDimensionLimit &&
+           reinterpret_cast<std::uintptr_t>(graph_.getDistanceData()) % 4 == 0;
+#else
+    return false;
+#endif
+}
+
+// Évalue toutes les lignes : pour la ligne i, j va de i + 2 à n - 1 (n - 2 pour i = 0,
+// dont l'arête (n - 1, 0) touche l'arête 0)
+void BestImprovementTwoOpt::sweep(const std::vector<int>& nodes, const std::vector<int>& edges) {
+    int n = static_cast<int>(edges.size());
+    int rows = n - 2;
+    rowDelta_.assign(n, 0);
+    rowJ_.assign(n, -1);
+    int tasks = (rows + kRowsPerTask - 1) / kRowsPerTask;
+    bool use_vector = hasVectorKernel();
+    withDistancePolicy(graph_, [&](const auto& dist) {
+        parallelFor(tasks, threadCount_, [&](int task, int) {
+            int last = std::min(rows, (task + 1) * kRowsPerTask);
+            for (int i = task * kRowsPerTask; i < last; ++i) {
+                int a = nodes[i];
+                int b = nodes[i + 1];
+                int end = (i == 0) ? n - 1 : n;
+                RowBest best;
+#ifdef TSP_HAVE_AVX2_KERNEL
+                if (use_vector) {
+                    best = scanRowVector(graph_, a, b, nodes.data(), edges.data(), i + 2, end);
+                } else
+#endif
+                {
+                    best = scanRowScalar(dist, a, b, nodes.data(), edges.data(), i + 2, end);
+                }
+                TSP_STATS_ADD(MovesEvaluated, end - i - 2);
+                if (best.j >= 0) {
+                    rowDelta_[i] = best.value - edges[i];
+                    rowJ_[i] = best.j;
+                }
+            }
+        });
+    });
+    (void)use_vector; // Sans noyau AVX2 compilé
+}
+
+// Balaye jusqu'à l'optimum local
+int BestImprovementTwoOpt::optimize(Tour& tour) {
+    int n = tour.size();
+    if (n < 8) {
+        return 0;
+    }
+    std::vector<int> nodes;
+    std::vector<int> edges(n);
+    std::vector<int> improving;
+    std::vector<char> used;
+    int sweeps = 0;
+    while (!CancellationToken::isCancelled(cancellation_)) {
+        nodes = tour.getNodes();
+        nodes.push_back(nodes.front()); // Sentinelle : l'arête n - 1 est (nodes[n - 1], nodes[0])
+        for (int j = 0; j < n; ++j) {
+            edges[j] = graph_.distance(nodes[j], nodes[j + 1]);
+        }
+        sweep(nodes, edges);
+        ++sweeps;
+
+        // Réduction : meilleurs mouvements des lignes, du plus au moins améliorant
+        improving.clear();
+        for (int i = 0; i < n; ++i) {
+            if (rowDelta_[i] < 0) {
+                improving.push_back(i);
+            }
+        }
+        if (improving.empty()) {
+            break;
+        }
+        std::sort(improving.begin(), improving.end(), [this](int x, int y) {
+            return rowDelta_[x] < rowDelta_[y] || (rowDelta_[x] == rowDelta_[y] && x < y);
+        });
+
+        // Un mouvement dont l'intervalle d'arêtes [i, j] est disjoint de ceux déjà appliqués
+        // retire deux arêtes encore présentes, parcourues dans un même sens : son gain reste exact
+        used.assign(n, 0);
+        int applied = 0;
+        for (int i : improving) {
+            int j = rowJ_[i];
+            int k = i;
+            while (k <= j && !used[k]) {
+                ++k;
+            }
+            if (k <= j) {
+                continue;
+            }
+            std::fill(used.begin() + i, used.begin() + j + 1, 1);
+            tour.twoOptMove(nodes[i], nodes[i + 1], nodes[j], nodes[j + 1], rowDelta_[i]);
+            ++applied;
+        }
+        TSP_STATS_ADD(MovesApplied, applied);
+    }
+    return sweeps;
+}
@@ -0,0 +1,58 @@
+#ifndef BEST_IMPROVEMENT_TWO_OPT_H
+#define BEST_IMPROVEMENT_TWO_OPT_H
+
+#include <vector>
+
+#include "Graph.h"
+#include "Tour.h"
+#include "CancellationToken.h"
+
+// 2-opt exhaustif en meilleure amélioration : chaque balayage évalue les N(N-3)/2
+// mouvements de la tournée, sans listes de candidats. Pour une arête (a, b) en
+// position i, le meilleur j minimise d(a, c) + d(b, d) - d(c, d), où (c, d) est
+// l'arête en position j : d(c, d) est lu dans un tableau des arêtes dans l'ordre de
+// la tournée, d(a, c) et d(b, d) sont rassemblés (gather AVX2, 8 valeurs de j à la
+// fois) dans les lignes de a et de b de la matrice complète. Les lignes i sont
+// réparties entre threads par blocs et leurs meilleurs mouvements réduits ensuite.
+// Chaque balayage applique, du plus au moins améliorant, tous les meilleurs mouvements
+// des lignes dont les intervalles d'arêtes [i, j] sont disjoints : leurs gains
+// s'additionnent exactement, ce qui divise le nombre de balayages.
+// Matrice triangulaire ou distances calculées : même balayage, noyau scalaire.
+class BestImprovementTwoOpt {
+public:
+    // Constructeur : prend une référence constante au graphe
+    explicit BestImprovementTwoOpt(const Graph& graph);
+
+    void setThreadCount(int threads) { threadCount_ = threads; }
+
+    // Jeton d'annulation consulté entre deux balayages (nullptr : aucun)
+    void setCancellation(const CancellationToken* token) { cancellation_ = token; }
+
+    // Faux : noyau scalaire même si le processeur dispose d'AVX2 (comparaisons)
+    void setVectorKernel(bool enabled) { vectorKernel_ = enabled; }
+
+    // Vrai si le noyau AVX2 est utilisable pour ce graphe (matrice complète, processeur)
+    bool hasVectorKernel() const;
+
+    // Balaye jusqu'à l'optimum local 2-opt ; retourne le nombre de balayages
+    int optimize(Tour& tour);
+
+private:
+    const Graph& graph_;
+    int threadCount_;
+    const CancellationToken* cancellation_ = nullptr;
+    bool vectorKernel_ = true;
+
+    // Meilleur mouvement de chaque ligne i du dernier balayage
+    std::vector<int> rowDelta_;
+    std::vector<int> rowJ_;
+
+    // Évalue toutes les lignes de la tournée nodes (nodes[n] = nodes[0]) dont les
+    // longueurs d'arêtes sont edges ; remplit rowDelta_ et rowJ_
+    void sweep(const std::vector<int>& nodes, const std::vector<int>& edges);
+
+    BestImprovementTwoOpt(const BestImprovementTwoOpt&) = delete;
+    BestImprovementTwoOpt& operator=(const BestImprovementTwoOpt&) = delete;
+};
+
+#endif
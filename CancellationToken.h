@@ -0,0 +1,28 @@
+#ifndef CANCELLATION_TOKEN_H
+#define CANCELLATION_TOKEN_H
+
+#include <atomic>
+
+// Demande d'arrêt coopérative : un thread appelant cancel(), les boucles de recherche
+// (recherche locale, Lin-Kernighan, recherche itérée, multi-départ, séparation et
+// évaluation) s'arrêtent au prochain contrôle et le solveur retourne la meilleure
+// tournée déjà trouvée. La lecture est une simple charge atomique, sans verrou.
+class CancellationToken {
+public:
+    CancellationToken() : cancelled_(false) {}
+
+    void cancel() { cancelled_.store(true, std::memory_order_relaxed); }
+    void reset() { cancelled_.store(false, std::memory_order_relaxed); }
+    bool isCancelled() const { return cancelled_.load(std::memory_order_relaxed); }
+
+    // Vrai si token est non nul et annulé
+    static bool isCancelled(const CancellationToken* token) { return token && token->isCancelled(); }
+
+private:
+    std::atomic<bool> cancelled_;
+
+    CancellationToken(const CancellationToken&) = delete;
+    CancellationToken& operator=(const CancellationToken&) = delete;
+};
+
+#endif
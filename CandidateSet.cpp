@@ -0,0 +1,85 @@
+#include "CandidateSet.h"
+#include "Graph.h"
+#include "KdTree.h"
+#include <algorithm> // Pour std::nth_element, std::sort, std::min
+#include <utility>   // Pour std::move
+
+// Construit les listes de candidats du graphe
+CandidateSet CandidateSet::build(const Graph& graph, int k) {
+    CandidateSet set;
+    int dimension = graph.getDimension();
+    k = std::min(k, dimension - 1);
+    if (k <= 0) {
+        return set;
+    }
+    std::shared_ptr<std::vector<int>> neighbors = std::make_shared<std::vector<int>>(static_cast<std::size_t>(dimension) * k);
+
+    // Ordre final : distance du graphe croissante, puis indice croissant
+    auto closer = [&graph](int from) {
+        return [&graph, from](int a, int b) {
+            int da = graph.distance(from, a);
+            int db = graph.distance(from, b);
+            return da < db || (da == db && a < b);
+        };
+    };
+
+    std::vector<int> row;
+    if (!graph.getNodeCoords().empty()) {
+        // Instances à coordonnées : requêtes k-NN dans un arbre k-d, O(N log N)
+        KdTree tree(graph.getNodeCoords());
+        for (int i = 0; i < dimension; ++i) {
+            tree.nearest(i, k, row);
+            // Les distances arrondies (EUC_2D, ATT) peuvent départager autrement
+            std::sort(row.begin(), row.end(), closer(i));
+            std::copy(row.begin(), row.end(), neighbors->begin() + static_cast<std::size_t>(i) * k);
+        }
+    } else {
+        // Instances EXPLICIT : tri partiel de chaque ligne de la matrice
+        row.reserve(dimension - 1);
+        for (int i = 0; i < dimension; ++i) {
+            row.clear();
+            for (int j = 0; j < dimension; ++j) {
+                if (j != i) {
+                    row.push_back(j);
+                }
+            }
+            std::nth_element(row.begin(), row.begin() + (k - 1), row.end(), closer(i));
+            std::sort(row.begin(), row.begin() + k, closer(i));
+            std::copy(row.begin(), row.begin() + k, neighbors->begin() + static_cast<std::size_t>(i) * k);
+        }
+    }
+    set.k_ = k;
+    set.neighbors_ = neighbors->data();
+    set.storage_ = std::move(neighbors);
+    return set;
+}
+
+// Listes lues dans un tampon externe
+CandidateSet CandidateSet::view(int k, const int* neighbors, std::shared_ptr<const void> storage) {
+    CandidateSet set;
+    set.k_ = k;
+    set.neighbors_ = neighbors;
+    set.storage_ = std::move(storage);
+    return set;
+}
+
+// Listes fournies par l'appelant
+CandidateSet CandidateSet::fromLists(int k, std::vector<int>&& neighbors, bool sortedByDistance) {
+    std::shared_ptr<std::vector<int>> storage = std::make_shared<std::vector<int>>(std::move(neighbors));
+    CandidateSet set;
+    set.k_ = k;
+    set.neighbors_ = storage->data();
+    set.storage_ = std::move(storage);
+    set.sortedByDistance_ = sortedByDistance;
+    return set;
+}
+
+// Vrai si j fait partie des candidats de i
+bool CandidateSet::contains(int i, int j) const {
+    for (const int* c = begin(i); c != end(i); ++c) {
+        if (*c == j) {
+            return true;
+        }
+    }
+    return false;
+}
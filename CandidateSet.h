@@ -0,0 +1,56 @@
+#ifndef CANDIDATE_SET_H
+#define CANDIDATE_SET_H
+
+#include <vector>
+#include <cstddef>
+#include <memory>
+
+// Déclaration anticipée de la classe Graph pour éviter une dépendance circulaire
+class Graph;
+
+// Listes de candidats : pour chaque nœud, ses k plus proches voisins triés par
+// distance croissante (ou k voisins dans un autre ordre de préférence, par exemple
+// l'α-proximité). Stockées dans un seul tableau plat de N * k entiers.
+class CandidateSet {
+public:
+    // Ensemble vide (aucune liste construite)
+    CandidateSet() = default;
+
+    // Construit les listes de k voisins du graphe : arbre k-d sur les coordonnées
+    // si le graphe en possède, sinon tri partiel des lignes de la matrice
+    static CandidateSet build(const Graph& graph, int k);
+
+    // Listes lues dans un tampon externe de N * k entiers (par exemple projeté en
+    // mémoire depuis un cache), que storage maintient en vie : aucune copie
+    static CandidateSet view(int k, const int* neighbors, std::shared_ptr<const void> storage);
+
+    // Listes fournies par l'appelant (N * k voisins, déplacés dans l'ensemble) ;
+    // sortedByDistance indique si chaque liste est triée par distance croissante
+    static CandidateSet fromLists(int k, std::vector<int>&& neighbors, bool sortedByDistance);
+
+    // Getters
+    bool empty() const { return k_ == 0; }
+    int getK() const { return k_; }
+
+    // Vrai si chaque liste est triée par distance croissante : un parcours peut alors
+    // s'arrêter au premier candidat trop éloigné
+    bool isSortedByDistance() const { return sortedByDistance_; }
+
+    // Parcours des voisins du nœud i : for (const int* c = begin(i); c != end(i); ++c)
+    const int* begin(int i) const { return neighbors_ + static_cast<std::size_t>(i) * k_; }
+    const int* end(int i) const { return begin(i) + k_; }
+
+    // Tampon des N * k voisins
+    const int* data() const { return neighbors_; }
+
+    // Vrai si j fait partie des candidats de i
+    bool contains(int i, int j) const;
+
+private:
+    int k_ = 0;
+    bool sortedByDistance_ = true;
+    const int* neighbors_ = nullptr;      // Voisins du nœud i dans [i * k_, (i + 1) * k_)
+    std::shared_ptr<const void> storage_; // Propriétaire du tampon (partagé entre copies)
+};
+
+#endif
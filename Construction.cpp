@@ -0,0 +1,371 @@
+#include "Construction.h"
+#include <algorithm> // Pour std::sort, std::unique, std::max, std::min, std::swap
+#include <cstdint>
+#include <memory>    // Pour std::unique_ptr
+#include <utility>   // Pour std::pair
+
+#include "CandidateSet.h"
+#include "DistancePolicy.h"
+#include "SpatialGrid.h"
+
+// Voisins par nœud quand le graphe n'a pas de listes de candidats
+static const int kFallbackCandidates = 10;
+
+// Résolution de la courbe de Hilbert : grille de 2^16 × 2^16 cellules
+static const int kHilbertOrder = 16;
+
+namespace {
+
+// Union-find avec compression de chemin (par division) et union par taille
+class DisjointSets {
+public:
+    explicit DisjointSets(int count) : parent_(count), size_(count, 1) {
+        for (int i = 0; i < count; ++i) {
+            parent_[i] = i;
+        }
+    }
+
+    int find(int node) {
+        while (parent_[node] != node) {
+            parent_[node] = parent_[parent_[node]];
+            node = parent_[node];
+        }
+        return node;
+    }
+
+    // Réunit les ensembles de a et b ; faux s'ils étaient déjà réunis
+    bool unite(int a, int b) {
+        a = find(a);
+        b = find(b);
+        if (a == b) {
+            return false;
+        }
+        if (size_[a] < size_[b]) {
+            std::swap(a, b);
+        }
+        parent_[b] = a;
+        size_[a] += size_[b];
+        return true;
+    }
+
+private:
+    std::vector<int> parent_;
+    std::vector<int> size_;
+};
+
+struct Edge {
+    int length;
+    int a;
+    int b;
+    bool operator<(const Edge& other) const {
+        if (length != other.length) {
+            return length < other.length;
+        }
+        return a < other.a || (a == other.a && b < other.b);
+    }
+};
+
+// Arêtes candidates sans doublon (a < b), triées par longueur croissante
+std::vector<Edge> sortedCandidateEdges(const Graph& graph) {
+    CandidateSet local;
+    const CandidateSet* candidates = &graph.getCandidates();
+    if (candidates->empty()) {
+        local = CandidateSet::build(graph, kFallbackCandidates);
+        candidates = &local;
+    }
+    std::vector<Edge> edges;
+    edges.reserve(static_cast<std::size_t>(graph.getDimension()) * candidates->getK());
+    withDistancePolicy(graph, [&](const auto& dist) {
+        for (int i = 0; i < graph.getDimension(); ++i) {
+            for (const int* c = candidates->begin(i); c != candidates->end(i); ++c) {
+                // Une arête présente dans les deux listes n'est retenue qu'une fois
+                if (i < *c || !candidates->contains(*c, i)) {
+                    edges.push_back(Edge{dist(i, *c), std::min(i, *c), std::max(i, *c)});
+                }
+            }
+        }
+    });
+    std::sort(edges.begin(), edges.end());
+    return edges;
+}
+
+// Plus proche nœud parmi un ensemble dont on retire les nœuds au fur et à mesure :
+// grille géométrique si le graphe a des coordonnées, parcours linéaire sinon
+class NearestRemaining {
+public:
+    NearestRemaining(const Graph& graph, const std::vector<int>& nodes)
+        : graph_(graph), slot_(graph.getDimension(), -1) {
+        if (!graph.getNodeCoords().empty()) {
+            grid_.reset(new SpatialGrid(graph.getNodeCoords()));
+            std::vector<char> keep(graph.getDimension(), 0);
+            for (int node : nodes) {
+                keep[node] = 1;
+            }
+            for (int i = 0; i < graph.getDimension(); ++i) {
+                if (!keep[i]) {
+                    grid_->remove(i);
+                }
+            }
+        } else {
+            nodes_ = nodes;
+            for (std::size_t s = 0; s < nodes_.size(); ++s) {
+                slot_[nodes_[s]] = static_cast<int>(s);
+            }
+        }
+    }
+
+    void remove(int node) {
+        if (grid_) {
+            grid_->remove(node);
+            return;
+        }
+        int s = slot_[node];
+        slot_[nodes_.back()] = s;
+        nodes_[s] = nodes_.back();
+        nodes_.pop_back();
+        slot_[node] = -1;
+    }
+
+    // Plus proche nœud restant de node, -1 s'il n'en reste aucun
+    int nearest(int node) const {
+        if (grid_) {
+            return grid_->nearest(graph_.getNodeCoords()[node]);
+        }
+        int best = -1;
+        int best_distance = 0;
+        for (int other : nodes_) {
+            int distance = graph_.distance(node, other);
+            if (best < 0 || distance < best_distance) {
+                best = other;
+                best_distance = distance;
+            }
+        }
+        return best;
+    }
+
+private:
+    const Graph& graph_;
+    std::unique_ptr<SpatialGrid> grid_;
+    std::vector<int> nodes_; // Nœuds restants (sans coordonnées)
+    std::vector<int> slot_;  // Position de chaque nœud dans nodes_
+};
+
+// Indice d'un point sur la courbe de Hilbert d'ordre order
+std::uint64_t hilbertIndex(std::uint32_t x, std::uint32_t y, int order) {
+    const std::uint32_t side = 1u << order;
+    std::uint64_t index = 0;
+    for (std::uint32_t s = side >> 1; s > 0; s >>= 1) {
+        std::uint32_t rx = (x & s) ? 1 : 0;
+        std::uint32_t ry = (y & s) ? 1 : 0;
+        index += static_cast<std::uint64_t>(s) * s * ((3 * rx) ^ ry);
+        // Rotation du quadrant pour que la sous-courbe soit dans l'orientation de base
+        if (ry == 0) {
+            if (rx == 1) {
+                x = side - 1 - x;
+                y = side - 1 - y;
+            }
+            std::swap(x, y);
+        }
+    }
+    return index;
+}
+
+} // namespace
+
+// Appariement glouton des arêtes
+std::vector<int> greedyEdgeTour(const Graph& graph) {
+    int n = graph.getDimension();
+    std::vector<int> order;
+    if (n <= 3) {
+        for (int i = 0; i < n; ++i) {
+            order.push_back(i);
+        }
+        return order;
+    }
+
+    // 1. Fragments : chaque nœud garde au plus deux voisins, sans jamais fermer de cycle
+    std::vector<int> links(2 * static_cast<std::size_t>(n), -1);
+    std::vector<int> degree(n, 0);
+    DisjointSets fragments(n);
+    for (const Edge& edge : sortedCandidateEdges(graph)) {
+        if (degree[edge.a] < 2 && degree[edge.b] < 2 && fragments.unite(edge.a, edge.b)) {
+            links[2 * edge.a + degree[edge.a]++] = edge.b;
+            links[2 * edge.b + degree[edge.b]++] = edge.a;
+        }
+    }
+
+    // 2. Parcours des fragments : depuis l'extrémité atteinte, saut vers l'extrémité
+    // libre la plus proche (les nœuds isolés sont des fragments d'un seul nœud)
+    std::vector<int> ends;
+    for (int i = 0; i < n; ++i) {
+        if (degree[i] < 2) {
+            ends.push_back(i);
+        }
+    }
+    NearestRemaining free_ends(graph, ends);
+    order.reserve(n);
+    int current = ends.front();
+    while (current != -1) {
+        free_ends.remove(current);
+        int previous = -1;
+        int node = current;
+        while (true) {
+            order.push_back(node);
+            int next = links[2 * node] != previous ? links[2 * node] : links[2 * node + 1];
+            if (next == -1 || next == previous) {
+                break;
+            }
+            previous = node;
+            node = next;
+        }
+        if (node != current) {
+            free_ends.remove(node);
+        }
+        current = free_ends.nearest(node);
+    }
+    return order;
+}
+
+// Parcours d'une courbe de Hilbert
+std::vector<int> spaceFillingCurveTour(const std::vector<Point>& points) {
+    int n = static_cast<int>(points.size());
+    std::vector<int> order(n);
+    if (n == 0) {
+        return order;
+    }
+    double min_x = points[0].x, max_x = points[0].x;
+    double min_y = points[0].y, max_y = points[0].y;
+    for (const Point& p : points) {
+        min_x = std::min(min_x, p.x);
+        max_x = std::max(max_x, p.x);
+        min_y = std::min(min_y, p.y);
+        max_y = std::max(max_y, p.y);
+    }
+    // Même échelle sur les deux axes : la courbe suit les proportions de l'instance
+    double span = std::max(max_x - min_x, max_y - min_y);
+    double scale = span > 0.0 ? ((1u << kHilbertOrder) - 1) / span : 0.0;
+
+    std::vector<std::pair<std::uint64_t, int>> keys(n);
+    for (int i = 0; i < n; ++i) {
+        std::uint32_t x = static_cast<std::uint32_t>((points[i].x - min_x) * scale);
+        std::uint32_t y = static_cast<std::uint32_t>((points[i].y - min_y) * scale);
+        keys[i] = std::make_pair(hilbertIndex(x, y, kHilbertOrder), i);
+    }
+    std::sort(keys.begin(), keys.end());
+    for (int i = 0; i < n; ++i) {
+        order[i] = keys[i].second;
+    }
+    return order;
+}
+
+// Heuristique de Christofides
+std::vector<int> christofidesTour(const Graph& graph) {
+    int n = graph.getDimension();
+    std::vector<int> order;
+    if (n <= 3) {
+        for (int i = 0; i < n; ++i) {
+            order.push_back(i);
+        }
+        return order;
+    }
+    std::vector<Edge> edges = sortedCandidateEdges(graph);
+
+    // 1. Arbre couvrant minimal du graphe des candidats (Kruskal) ; s'il n'est pas
+    // connexe, les composantes sont reliées à la suite les unes des autres
+    std::vector<std::pair<int, int>> multigraph; // Arêtes de l'arbre puis du couplage
+    std::vector<int> degree(n, 0);
+    DisjointSets components(n);
+    for (const Edge& edge : edges) {
+        if (components.unite(edge.a, edge.b)) {
+            multigraph.push_back(std::make_pair(edge.a, edge.b));
+        }
+    }
+    int previous_root = components.find(0);
+    for (int i = 1; i < n; ++i) {
+        if (components.unite(previous_root, i)) {
+            multigraph.push_back(std::make_pair(previous_root, i));
+            previous_root = components.find(i);
+        }
+    }
+    for (const std::pair<int, int>& edge : multigraph) {
+        ++degree[edge.first];
+        ++degree[edge.second];
+    }
+
+    // 2. Couplage glouton des nœuds de degré impair : arêtes candidates d'abord, puis
+    // chaque nœud restant avec le plus proche des autres restants
+    std::vector<char> unmatched(n, 0);
+    for (int i = 0; i < n; ++i) {
+        unmatched[i] = degree[i] % 2;
+    }
+    for (const Edge& edge : edges) {
+        if (unmatched[edge.a] && unmatched[edge.b]) {
+            multigraph.push_back(std::make_pair(edge.a, edge.b));
+            unmatched[edge.a] = unmatched[edge.b] = 0;
+        }
+    }
+    std::vector<int> odd;
+    for (int i = 0; i < n; ++i) {
+        if (unmatched[i]) {
+            odd.push_back(i);
+        }
+    }
+    NearestRemaining remaining(graph, odd);
+    for (int node : odd) {
+        if (!unmatched[node]) {
+            continue;
+        }
+        remaining.remove(node);
+        int partner = remaining.nearest(node);
+        remaining.remove(partner);
+        unmatched[node] = unmatched[partner] = 0;
+        multigraph.push_back(std::make_pair(node, partner));
+    }
+
+    // 3. Circuit eulérien (Hierholzer, itératif) : tous les degrés sont pairs
+    int edge_count = static_cast<int>(multigraph.size());
+    std::vector<int> start(n + 1, 0);
+    for (const std::pair<int, int>& edge : multigraph) {
+        ++start[edge.first + 1];
+        ++start[edge.second + 1];
+    }
+    for (int i = 0; i < n; ++i) {
+        start[i + 1] += start[i];
+    }
+    std::vector<int> incident(2 * static_cast<std::size_t>(edge_count));
+    std::vector<int> fill(start.begin(), start.end() - 1);
+    for (int e = 0; e < edge_count; ++e) {
+        incident[fill[multigraph[e].first]++] = e;
+        incident[fill[multigraph[e].second]++] = e;
+    }
+    std::vector<char> used(edge_count, 0);
+    std::vector<int> next_edge(start.begin(), start.end() - 1);
+    std::vector<int> stack(1, 0);
+    std::vector<int> circuit;
+    circuit.reserve(edge_count + 1);
+    while (!stack.empty()) {
+        int v = stack.back();
+        while (next_edge[v] < start[v + 1] && used[incident[next_edge[v]]]) {
+            ++next_edge[v];
+        }
+        if (next_edge[v] == start[v + 1]) {
+            circuit.push_back(v);
+            stack.pop_back();
+        } else {
+            int e = incident[next_edge[v]++];
+            used[e] = 1;
+            stack.push_back(multigraph[e].first == v ? multigraph[e].second : multigraph[e].first);
+        }
+    }
+
+    // 4. Raccourcis : chaque nœud n'est gardé qu'à sa première visite
+    std::vector<char> visited(n, 0);
+    order.reserve(n);
+    for (int v : circuit) {
+        if (!visited[v]) {
+            visited[v] = 1;
+            order.push_back(v);
+        }
+    }
+    return order;
+}
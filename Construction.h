@@ -0,0 +1,28 @@
+#ifndef CONSTRUCTION_H
+#define CONSTRUCTION_H
+
+#include <vector>
+
+#include "Geometry.h"
+#include "Graph.h"
+
+// Heuristiques de construction d'une tournée de départ (autres que le plus proche
+// voisin de TspSolver). Chacune retourne l'ordre de visite des N nœuds.
+
+// Appariement glouton des arêtes : les arêtes candidates sont prises de la plus courte
+// à la plus longue tant qu'elles ne créent ni nœud de degré 3 ni cycle (union-find) ;
+// les fragments obtenus sont ensuite reliés d'extrémité en extrémité, au plus proche.
+// Sans listes de candidats, des listes de 10 voisins sont construites pour l'occasion.
+std::vector<int> greedyEdgeTour(const Graph& graph);
+
+// Ordre de parcours d'une courbe de Hilbert sur les coordonnées : O(N log N), sans
+// aucune distance calculée (instances à coordonnées seulement).
+std::vector<int> spaceFillingCurveTour(const std::vector<Point>& points);
+
+// Heuristique de Christofides : arbre couvrant minimal (sur les arêtes candidates),
+// couplage des nœuds de degré impair, circuit eulérien puis raccourcis. Le couplage
+// est glouton (arêtes candidates, puis plus proches nœuds restants) et non de poids
+// minimal : la garantie de facteur 3/2 ne tient donc pas.
+std::vector<int> christofidesTour(const Graph& graph);
+
+#endif
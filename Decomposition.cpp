@@ -0,0 +1,222 @@
+#include "Decomposition.h"
+#include "CandidateSet.h"
+#include "LinKernighan.h"
+#include "Parallel.h"
+#include "Stats.h"
+
+#include <algorithm> // Pour std::nth_element, std::min, std::max
+#include <numeric>   // Pour std::iota
+#include <utility>
+
+// Taille minimale d'une grappe (en deçà, la recherche locale n'a plus d'effet)
+static const int kMinClusterSize = 8;
+
+// Candidats des sous-graphes si le graphe complet n'en a pas
+static const int kDefaultCandidates = 10;
+
+namespace {
+
+// Centre (moyenne des coordonnées) d'un ensemble de nœuds
+Point centroid(const std::vector<Point>& points, const std::vector<int>& nodes) {
+    Point center{0.0, 0.0};
+    for (int v : nodes) {
+        center.x += points[v].x;
+        center.y += points[v].y;
+    }
+    if (!nodes.empty()) {
+        center.x /= nodes.size();
+        center.y /= nodes.size();
+    }
+    return center;
+}
+
+// Carré de la distance euclidienne (comparaisons seulement)
+double squaredDistance(const Point& p, const Point& q) {
+    double dx = p.x - q.x;
+    double dy = p.y - q.y;
+    return dx * dx + dy * dy;
+}
+
+} // namespace
+
+// Constructeur
+Decomposition::Decomposition(const Graph& graph) : graph_(graph), threadCount_(hardwareThreads()) {}
+
+// Découpage k-d : les feuilles sont produites de gauche à droite (pile, moitié basse d'abord)
+std::vector<std::vector<int>> Decomposition::partition() const {
+    const std::vector<Point>& points = graph_.getNodeCoords();
+    int limit = std::max(clusterSize_, kMinClusterSize);
+    std::vector<int> nodes(points.size());
+    std::iota(nodes.begin(), nodes.end(), 0);
+
+    std::vector<std::vector<int>> clusters;
+    std::vector<std::pair<int, int>> stack(1, std::make_pair(0, static_cast<int>(nodes.size())));
+    while (!stack.empty()) {
+        int begin = stack.back().first;
+        int end = stack.back().second;
+        stack.pop_back();
+        if (end - begin <= limit) {
+            clusters.emplace_back(nodes.begin() + begin, nodes.begin() + end);
+            continue;
+        }
+        // Coupe à la médiane du plus grand côté de la boîte englobante
+        double min_x = points[nodes[begin]].x, max_x = min_x;
+        double min_y = points[nodes[begin]].y, max_y = min_y;
+        for (int i = begin + 1; i < end; ++i) {
+            const Point& p = points[nodes[i]];
+            min_x = std::min(min_x, p.x);
+            max_x = std::max(max_x, p.x);
+            min_y = std::min(min_y, p.y);
+            max_y = std::max(max_y, p.y);
+        }
+        bool split_x = (max_x - min_x) >= (max_y - min_y);
+        int middle = begin + (end - begin) / 2;
+        std::nth_element(nodes.begin() + begin, nodes.begin() + middle, nodes.begin() + end,
+                         [&points, split_x](int a, int b) {
+                             return split_x ? points[a].x < points[b].x : points[a].y < points[b].y;
+                         });
+        stack.emplace_back(middle, end);
+        stack.emplace_back(begin, middle);
+    }
+    return clusters;
+}
+
+// Ordre de visite des grappes : tournée de leurs centres (petite instance à coordonnées)
+std::vector<int> Decomposition::orderClusters(const std::vector<std::vector<int>>& clusters) const {
+    int count = static_cast<int>(clusters.size());
+    std::vector<int> order(count);
+    std::iota(order.begin(), order.end(), 0);
+    if (count <= 3) {
+        return order;
+    }
+    std::vector<Point> centers;
+    for (const std::vector<int>& nodes : clusters) {
+        centers.push_back(centroid(graph_.getNodeCoords(), nodes));
+    }
+    Graph center_graph(std::move(centers), graph_.getCoordMetric());
+    center_graph.setCandidates(CandidateSet::build(center_graph, kDefaultCandidates));
+    TspSolver solver(center_graph);
+    solver.setThreadCount(1);
+    solver.setSeed(subOptions_.seed);
+    return solver.solve().getNodes();
+}
+
+// Enchaîne les sous-tournées : chacune est ouverte au nœud le plus proche de la sortie
+// précédente (son entrée), puis parcourue dans le sens dont le dernier nœud (voisin de
+// l'entrée dans la sous-tournée) est le plus proche de la grappe suivante
+std::vector<int> Decomposition::stitch(const std::vector<std::vector<int>>& subTours,
+                                       const std::vector<int>& order) const {
+    const std::vector<Point>& points = graph_.getNodeCoords();
+    int count = static_cast<int>(order.size());
+    std::vector<Point> centers;
+    for (const std::vector<int>& nodes : subTours) {
+        centers.push_back(centroid(points, nodes));
+    }
+
+    std::vector<int> result;
+    result.reserve(points.size());
+    Point previous = centers[order.back()];
+    for (int k = 0; k < count; ++k) {
+        const std::vector<int>& sub = subTours[order[k]];
+        int size = static_cast<int>(sub.size());
+        if (size == 0) {
+            continue;
+        }
+        int entry = 0;
+        for (int i = 1; i < size; ++i) {
+            if (squaredDistance(points[sub[i]], previous) < squaredDistance(points[sub[entry]], previous)) {
+                entry = i;
+            }
+        }
+        // La dernière grappe revient vers le premier nœud de la tournée
+        Point target = k + 1 < count ? centers[order[k + 1]] : (result.empty() ? previous : points[result.front()]);
+        int forward_exit = sub[(entry + size - 1) % size];
+        int backward_exit = sub[(entry + 1) % size];
+        bool forward = squaredDistance(points[forward_exit], target) <= squaredDistance(points[backward_exit], target);
+        for (int t = 0; t < size; ++t) {
+            result.push_back(sub[forward ? (entry + t) % size : (entry - t + size) % size]);
+        }
+        previous = points[result.back()];
+    }
+    return result;
+}
+
+// Découpe, résout chaque grappe, assemble puis répare les frontières
+Tour Decomposition::solve() const {
+    const std::vector<Point>& points = graph_.getNodeCoords();
+    std::vector<std::vector<int>> clusters;
+    {
+        TSP_STATS_TIMER(Decomposition);
+        clusters = partition();
+    }
+    int count = static_cast<int>(clusters.size());
+    int threads = std::max(1, std::min(threadCount_, count));
+
+    // Options des grappes : un thread chacune, budget de temps réparti par vagues de threads
+    TspSolver::Options options = subOptions_;
+    options.threads = 1;
+    options.targetLength = 0;
+    options.clusterSize = 0;
+    options.onImprovement = nullptr;
+    if (options.timeLimit > 0.0) {
+        int waves = (count + threads - 1) / threads;
+        options.timeLimit /= waves;
+    }
+    int k = graph_.getCandidates().empty() ? kDefaultCandidates : graph_.getCandidates().getK();
+
+    // Chaque grappe est un sous-graphe indépendant, construit et libéré par son thread
+    std::vector<std::vector<int>> sub_tours(count);
+    parallelFor(count, threads, [&](int cluster, int) {
+        const std::vector<int>& nodes = clusters[cluster];
+        if (CancellationToken::isCancelled(options.cancellation)) {
+            sub_tours[cluster] = nodes; // Annulation : ordre du découpage, tournée valide
+            return;
+        }
+        std::vector<Point> coords;
+        coords.reserve(nodes.size());
+        for (int v : nodes) {
+            coords.push_back(points[v]);
+        }
+        Graph sub(std::move(coords), graph_.getCoordMetric());
+        sub.setCandidates(CandidateSet::build(sub, k));
+        TspSolver solver(sub, options);
+        Tour tour = solver.solve();
+        sub_tours[cluster].reserve(nodes.size());
+        for (int local : tour.getNodes()) {
+            sub_tours[cluster].push_back(nodes[local]);
+        }
+    });
+
+    std::vector<int> stitched;
+    {
+        TSP_STATS_TIMER(Decomposition);
+        stitched = stitch(sub_tours, orderClusters(clusters));
+    }
+    Tour tour(stitched, graph_);
+
+    // Réparation : seuls les nœuds dont un candidat appartient à une autre grappe sont actifs
+    const CandidateSet& candidates = graph_.getCandidates();
+    if (candidates.empty()) {
+        std::cerr << "Avertissement: Pas de listes de candidats, frontières des grappes non réparées." << std::endl;
+        return tour;
+    }
+    std::vector<int> cluster_of(points.size());
+    for (int cluster = 0; cluster < count; ++cluster) {
+        for (int v : clusters[cluster]) {
+            cluster_of[v] = cluster;
+        }
+    }
+    std::vector<int> boundary;
+    for (int v = 0; v < static_cast<int>(points.size()); ++v) {
+        for (const int* c = candidates.begin(v); c != candidates.end(v); ++c) {
+            if (cluster_of[*c] != cluster_of[v]) {
+                boundary.push_back(v);
+                break;
+            }
+        }
+    }
+    TSP_STATS_TIMER(LinKernighan);
+    LinKernighan engine(graph_);
+    engine.setCancellation(options.cancellation);
+    return engine.optimize(tour, boundary);
+}
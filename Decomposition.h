@@ -0,0 +1,60 @@
+#ifndef DECOMPOSITION_H
+#define DECOMPOSITION_H
+
+#include <vector>
+
+#include "Graph.h"
+#include "Tour.h"
+#include "TspSolver.h"
+
+// Résolution par décomposition géométrique des très grandes instances à coordonnées.
+// 1. Découpage k-d : la boîte englobante est coupée à la médiane de son plus grand côté
+//    jusqu'à des grappes d'au plus clusterSize nœuds (entre la moitié et clusterSize).
+// 2. Chaque grappe est un sous-graphe indépendant (distances à la demande, ses propres
+//    listes de candidats) résolu par un TspSolver à un thread ; les grappes sont
+//    réparties entre les threads, la mémoire d'un thread reste celle d'une grappe.
+// 3. Les grappes sont enchaînées dans l'ordre d'une tournée de leurs centres ; chaque
+//    sous-tournée est ouverte en chemin, entrée au plus près de la sortie précédente et
+//    parcourue dans le sens dont la sortie est la plus proche de la grappe suivante.
+// 4. Réparation : Lin-Kernighan sur la tournée complète (liste à deux niveaux), avec les
+//    seuls nœuds de frontière actifs (un de leurs candidats est dans une autre grappe).
+class Decomposition {
+public:
+    // Taille de grappe par défaut : une grappe se résout en une fraction de seconde
+    static const int kDefaultClusterSize = 5000;
+
+    // Constructeur : graphe à coordonnées (ses listes de candidats servent à la réparation)
+    explicit Decomposition(const Graph& graph);
+
+    void setClusterSize(int nodes) { clusterSize_ = nodes; }
+    void setThreadCount(int threads) { threadCount_ = threads; }
+
+    // Options de résolution des grappes. Chaque grappe a un thread ; le budget de temps
+    // est réparti entre les grappes (budget × threads / grappes) ; la longueur cible,
+    // le rappel d'amélioration et la taille de grappe sont ignorés. Le jeton
+    // d'annulation arrête aussi le découpage restant et la réparation.
+    void setSubSolverOptions(const TspSolver::Options& options) { subOptions_ = options; }
+
+    // Grappes : indices des nœuds de chacune, dans l'ordre des feuilles du découpage
+    std::vector<std::vector<int>> partition() const;
+
+    // Découpe, résout, assemble et répare ; retourne la tournée complète
+    Tour solve() const;
+
+private:
+    const Graph& graph_;
+    int clusterSize_ = kDefaultClusterSize;
+    int threadCount_;
+    TspSolver::Options subOptions_;
+
+    // Ordre de visite des grappes : tournée de leurs centres
+    std::vector<int> orderClusters(const std::vector<std::vector<int>>& clusters) const;
+
+    // Enchaîne les sous-tournées (indices globaux) dans l'ordre order
+    std::vector<int> stitch(const std::vector<std::vector<int>>& subTours, const std::vector<int>& order) const;
+
+    Decomposition(const Decomposition&) = delete;
+    Decomposition& operator=(const Decomposition&) = delete;
+};
+
+#endif
@@ -0,0 +1,96 @@
+#ifndef DISTANCE_POLICY_H
+#define DISTANCE_POLICY_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Graph.h"
+
+// Politiques de distance : foncteurs d(i, j) spécialisés pour une représentation
+// du graphe (matrice complète ou triangulaire d'un type de poids donné, coordonnées
+// EUC_2D ou ATT). Passés en paramètre de modèle aux boucles critiques, ils leur
+// évitent les aiguillages de Graph::distance : l'accès est une lecture de tableau
+// ou un calcul en ligne.
+
+// Matrice complète
+template <typename Weight>
+struct FullMatrixDistance {
+    const Weight* data;
+    std::size_t dimension;
+
+    int operator()(int i, int j) const {
+        TSP_STATS_ADD(DistanceLookups, 1);
+        return data[static_cast<std::size_t>(i) * dimension + static_cast<std::size_t>(j)];
+    }
+};
+
+// Triangle supérieur
+template <typename Weight>
+struct TriangleMatrixDistance {
+    const Weight* data;
+    int dimension;
+
+    int operator()(int i, int j) const {
+        TSP_STATS_ADD(DistanceLookups, 1);
+        return data[i <= j ? upperTriangleIndex(i, j, dimension) : upperTriangleIndex(j, i, dimension)];
+    }
+};
+
+// Distance EUC_2D calculée à partir des coordonnées
+struct Euc2dDistance {
+    const Point* coords;
+
+    int operator()(int i, int j) const {
+        TSP_STATS_ADD(DistanceLookups, 1);
+        return euclideanDistance(coords[i], coords[j]);
+    }
+};
+
+// Distance ATT calculée à partir des coordonnées
+struct AttDistance {
+    const Point* coords;
+
+    int operator()(int i, int j) const {
+        TSP_STATS_ADD(DistanceLookups, 1);
+        return attDistance(coords[i], coords[j]);
+    }
+};
+
+namespace detail {
+template <typename Weight, typename Body>
+void withMatrixDistance(const Graph& graph, Body&& body) {
+    const Weight* data = static_cast<const Weight*>(graph.getDistanceData());
+    if (graph.getLayout() == MatrixLayout::Full) {
+        body(FullMatrixDistance<Weight>{data, static_cast<std::size_t>(graph.getDimension())});
+    } else {
+        body(TriangleMatrixDistance<Weight>{data, graph.getDimension()});
+    }
+}
+} // namespace detail
+
+// Point d'aiguillage unique : appelle body(distance) avec la politique correspondant
+// à la représentation du graphe. body est typiquement un lambda générique, instancié
+// une fois par politique ; l'aiguillage a lieu une seule fois, hors des boucles.
+template <typename Body>
+void withDistancePolicy(const Graph& graph, Body&& body) {
+    if (graph.getDistanceMode() == DistanceMode::Matrix) {
+        switch (graph.getWeightType()) {
+        case WeightType::UInt16:
+            detail::withMatrixDistance<std::uint16_t>(graph, body);
+            return;
+        case WeightType::UInt8:
+            detail::withMatrixDistance<std::uint8_t>(graph, body);
+            return;
+        default:
+            detail::withMatrixDistance<int>(graph, body);
+            return;
+        }
+    }
+    if (graph.getCoordMetric() == CoordMetric::Att) {
+        body(AttDistance{graph.getNodeCoords().data()});
+    } else {
+        body(Euc2dDistance{graph.getNodeCoords().data()});
+    }
+}
+
+#endif
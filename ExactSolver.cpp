@@ -0,0 +1,330 @@
+#include "ExactSolver.h"
+#include <algorithm> // Pour std::sort, std::reverse, std::min
+#include <atomic>
+#include <climits>   // Pour INT_MAX
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+#include "HeldKarpBound.h"
+#include "Parallel.h"
+#include "Stats.h"
+
+// Nœuds explorés par défaut avant d'abandonner la preuve d'optimalité
+static const long kDefaultNodeLimit = 5000000;
+
+// Sous-ensembles traités par tâche dans une couche de la programmation dynamique
+static const int kDynamicProgrammingChunk = 4096;
+
+// Nœuds explorés localement avant de mettre à jour le compteur commun
+static const long kNodeCountBatch = 1024;
+
+namespace {
+
+// Séparation et évaluation : état partagé entre les threads. Chaque thread explore
+// les branches d'un deuxième nœud de la tournée (le premier est le nœud 0).
+struct BranchAndBound {
+    int n;
+    const int* matrix;     // Distances, n × n
+    const double* reduced; // Distances pénalisées d(i, j) + π(i) + π(j), n × n
+    const double* pi;
+    long nodeLimit;
+    const CancellationToken* cancellation;
+    std::atomic<long> bestLength;
+    std::atomic<long> nodes;
+    std::atomic<bool> aborted;
+    std::mutex bestMutex;
+    std::vector<int> bestOrder;
+
+    // Minorant de la longueur de toute tournée prolongeant le chemin courant : le reste
+    // de la tournée va de current à 0 par tous les nœuds non visités U, soit une arête
+    // de current vers U, un chemin couvrant U (au moins l'arbre couvrant minimal de U) et
+    // une arête de U vers 0. Sur les distances pénalisées, ce coût est diminué des
+    // pénalités π(current) + π(0) + 2 Σ π(U) pour revenir aux distances d'origine.
+    double lowerBound(int current, std::uint64_t visited, long length) const {
+        int nodes_left[ExactSolver::kBranchAndBoundLimit];
+        int count = 0;
+        double penalty = pi[current] + pi[0];
+        for (int v = 1; v < n; ++v) {
+            if (!(visited >> v & 1)) {
+                nodes_left[count++] = v;
+                penalty += 2.0 * pi[v];
+            }
+        }
+        const double* from_current = reduced + static_cast<std::size_t>(current) * n;
+        if (count == 0) {
+            // Tous les nœuds visités : seule l'arête de retour vers 0 reste
+            return static_cast<double>(length) + from_current[0] - penalty;
+        }
+        const double* from_start = reduced;
+        double enter = from_current[nodes_left[0]];
+        double leave = from_start[nodes_left[0]];
+        // Prim en O(|U|²), avec les arêtes de raccordement à current et 0
+        double key[ExactSolver::kBranchAndBoundLimit];
+        bool in_tree[ExactSolver::kBranchAndBoundLimit];
+        const double* first_row = reduced + static_cast<std::size_t>(nodes_left[0]) * n;
+        for (int t = 0; t < count; ++t) {
+            key[t] = first_row[nodes_left[t]];
+            in_tree[t] = false;
+            enter = std::min(enter, from_current[nodes_left[t]]);
+            leave = std::min(leave, from_start[nodes_left[t]]);
+        }
+        in_tree[0] = true;
+        double tree = enter + leave;
+        for (int added = 1; added < count; ++added) {
+            int next = -1;
+            for (int t = 1; t < count; ++t) {
+                if (!in_tree[t] && (next < 0 || key[t] < key[next])) {
+                    next = t;
+                }
+            }
+            in_tree[next] = true;
+            tree += key[next];
+            const double* row = reduced + static_cast<std::size_t>(nodes_left[next]) * n;
+            for (int t = 1; t < count; ++t) {
+                if (!in_tree[t] && row[nodes_left[t]] < key[t]) {
+                    key[t] = row[nodes_left[t]];
+                }
+            }
+        }
+        return static_cast<double>(length) + tree - penalty;
+    }
+
+    // Exploration en profondeur ; path[0..depth-1] est le chemin courant
+    void search(int* path, int depth, std::uint64_t visited, long length, long& localNodes) {
+        if (aborted.load(std::memory_order_relaxed)) {
+            return;
+        }
+        if (++localNodes == kNodeCountBatch) {
+            long total = nodes.fetch_add(localNodes, std::memory_order_relaxed) + localNodes;
+            localNodes = 0;
+            if ((nodeLimit > 0 && total >= nodeLimit) || CancellationToken::isCancelled(cancellation)) {
+                aborted = true;
+                return;
+            }
+        }
+        int current = path[depth - 1];
+        const int* row = matrix + static_cast<std::size_t>(current) * n;
+        if (depth == n) {
+            long total = length + row[0];
+            if (total < bestLength.load(std::memory_order_relaxed)) {
+                std::lock_guard<std::mutex> lock(bestMutex);
+                if (total < bestLength.load(std::memory_order_relaxed)) {
+                    bestOrder.assign(path, path + n);
+                    bestLength = total;
+                }
+            }
+            return;
+        }
+        // Les longueurs étant entières, un minorant supérieur à best - 1 exclut toute amélioration
+        if (lowerBound(current, visited, length) - 1e-6 > bestLength.load(std::memory_order_relaxed) - 1) {
+            return;
+        }
+        // Nœuds suivants, du plus proche au plus éloigné
+        int children[ExactSolver::kBranchAndBoundLimit];
+        int count = 0;
+        for (int v = 1; v < n; ++v) {
+            if (!(visited >> v & 1)) {
+                children[count++] = v;
+            }
+        }
+        std::sort(children, children + count, [row](int a, int b) { return row[a] < row[b]; });
+        for (int c = 0; c < count; ++c) {
+            int v = children[c];
+            path[depth] = v;
+            search(path, depth + 1, visited | (std::uint64_t(1) << v), length + row[v], localNodes);
+        }
+    }
+};
+
+} // namespace
+
+// Constructeur
+ExactSolver::ExactSolver(const Graph& graph)
+    : graph_(graph), dimension_(graph.getDimension()), threadCount_(hardwareThreads()), nodeLimit_(kDefaultNodeLimit) {
+    if (dimension_ <= kBranchAndBoundLimit) {
+        matrix_.resize(static_cast<std::size_t>(dimension_) * dimension_);
+        for (int i = 0; i < dimension_; ++i) {
+            for (int j = 0; j < dimension_; ++j) {
+                matrix_[static_cast<std::size_t>(i) * dimension_ + j] = graph_.distance(i, j);
+            }
+        }
+    }
+}
+
+// Longueur de la tournée order
+long ExactSolver::tourLength(const std::vector<int>& order) const {
+    long length = 0;
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        int a = order[i];
+        int b = order[i + 1 == order.size() ? 0 : i + 1];
+        length += matrix_[static_cast<std::size_t>(a) * dimension_ + b];
+    }
+    return length;
+}
+
+// Programmation dynamique de Held et Karp.
+// cost[S][j] : plus court chemin partant du nœud 0, visitant exactement l'ensemble S
+// (nœuds 1..N-1, le bit j désignant le nœud j + 1) et finissant en j. Chaque couche
+// (|S| fixé) ne dépend que de la précédente : ses sous-ensembles sont traités en parallèle.
+// La ligne cost[S] est contiguë, et la boucle interne parcourt une ligne de distances.
+bool ExactSolver::solveDynamicProgramming(std::vector<int>& order) const {
+    TSP_STATS_TIMER(Exact);
+    int n = dimension_;
+    if (n > kDynamicProgrammingLimit) {
+        return false;
+    }
+    if (n <= 3) {
+        // Une seule tournée à sens près
+        order.resize(n);
+        for (int i = 0; i < n; ++i) {
+            order[i] = i;
+        }
+        return true;
+    }
+    int max_edge = *std::max_element(matrix_.begin(), matrix_.end());
+    if (static_cast<long>(max_edge) * n > INT_MAX) {
+        return false;
+    }
+
+    // Distances entre les nœuds 1..N-1 (indices décalés de 1), rangées par nœud d'arrivée :
+    // into[j][k] = d(k, j)
+    int m = n - 1;
+    std::vector<int> into(static_cast<std::size_t>(m) * m);
+    for (int j = 0; j < m; ++j) {
+        for (int k = 0; k < m; ++k) {
+            into[static_cast<std::size_t>(j) * m + k] = matrix_[static_cast<std::size_t>(k + 1) * n + j + 1];
+        }
+    }
+    const std::size_t states = std::size_t(1) << m;
+    std::unique_ptr<int[]> cost(new int[states * m]); // Seules les cases j ∈ S sont lues
+    for (int j = 0; j < m; ++j) {
+        cost[(std::size_t(1) << j) * m + j] = matrix_[j + 1];
+    }
+
+    std::vector<std::uint32_t> layer;
+    for (int size = 2; size <= m; ++size) {
+        // Sous-ensembles de taille size, par ordre croissant (méthode de Gosper)
+        layer.clear();
+        for (std::uint32_t mask = (1u << size) - 1; mask < states;) {
+            layer.push_back(mask);
+            std::uint32_t low = mask & (~mask + 1);
+            std::uint32_t ripple = mask + low;
+            mask = (((ripple ^ mask) >> 2) / low) | ripple;
+        }
+        int count = static_cast<int>(layer.size());
+        int chunks = (count + kDynamicProgrammingChunk - 1) / kDynamicProgrammingChunk;
+        parallelFor(chunks, std::min(threadCount_, chunks), [&](int chunk, int) {
+            int end = std::min(count, (chunk + 1) * kDynamicProgrammingChunk);
+            for (int index = chunk * kDynamicProgrammingChunk; index < end; ++index) {
+                std::uint32_t mask = layer[index];
+                int* row = &cost[static_cast<std::size_t>(mask) * m];
+                for (std::uint32_t bits = mask; bits; bits &= bits - 1) {
+                    int j = __builtin_ctz(bits);
+                    std::uint32_t previous = mask ^ (1u << j);
+                    const int* previous_row = &cost[static_cast<std::size_t>(previous) * m];
+                    const int* to_j = &into[static_cast<std::size_t>(j) * m];
+                    int best = INT_MAX;
+                    for (std::uint32_t rest = previous; rest; rest &= rest - 1) {
+                        int k = __builtin_ctz(rest);
+                        best = std::min(best, previous_row[k] + to_j[k]);
+                    }
+                    row[j] = best;
+                }
+            }
+        });
+    }
+
+    // Fermeture vers le nœud 0, puis reconstruction en remontant les couches
+    std::uint32_t mask = static_cast<std::uint32_t>(states - 1);
+    int last = 0;
+    long best = -1;
+    for (int j = 0; j < m; ++j) {
+        long length = static_cast<long>(cost[static_cast<std::size_t>(mask) * m + j]) + matrix_[static_cast<std::size_t>(j + 1) * n];
+        if (best < 0 || length < best) {
+            best = length;
+            last = j;
+        }
+    }
+    order.clear();
+    while (true) {
+        order.push_back(last + 1);
+        std::uint32_t previous = mask ^ (1u << last);
+        if (previous == 0) {
+            break;
+        }
+        int target = cost[static_cast<std::size_t>(mask) * m + last];
+        for (std::uint32_t rest = previous; rest; rest &= rest - 1) {
+            int k = __builtin_ctz(rest);
+            if (cost[static_cast<std::size_t>(previous) * m + k] + into[static_cast<std::size_t>(last) * m + k] == target) {
+                last = k;
+                break;
+            }
+        }
+        mask = previous;
+    }
+    order.push_back(0);
+    std::reverse(order.begin(), order.end());
+    return true;
+}
+
+// Séparation et évaluation en profondeur d'abord, les premières branches (deuxième
+// nœud de la tournée) réparties entre threads avec une meilleure longueur commune
+bool ExactSolver::solveBranchAndBound(std::vector<int>& order) const {
+    TSP_STATS_TIMER(Exact);
+    int n = dimension_;
+    if (n > kBranchAndBoundLimit || static_cast<int>(order.size()) != n) {
+        return false;
+    }
+    if (n <= 3) {
+        return true;
+    }
+
+    // Pénalités de la borne de Held-Karp : l'arbre couvrant pénalisé est un minorant bien plus serré
+    HeldKarpBound bound(graph_);
+    if (!bound.compute()) {
+        return false;
+    }
+    long upper = tourLength(order);
+    if (bound.getLowerBound() >= upper) {
+        return true;
+    }
+    const std::vector<double>& pi = bound.getPenalties();
+    std::vector<double> reduced(static_cast<std::size_t>(n) * n);
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) {
+            reduced[static_cast<std::size_t>(i) * n + j] = matrix_[static_cast<std::size_t>(i) * n + j] + pi[i] + pi[j];
+        }
+    }
+
+    BranchAndBound search;
+    search.n = n;
+    search.matrix = matrix_.data();
+    search.reduced = reduced.data();
+    search.pi = pi.data();
+    search.nodeLimit = nodeLimit_;
+    search.cancellation = cancellation_;
+    search.bestLength = upper;
+    search.nodes = 0;
+    search.aborted = false;
+
+    // Deuxièmes nœuds, du plus proche au plus éloigné du nœud 0
+    std::vector<int> seconds;
+    for (int v = 1; v < n; ++v) {
+        seconds.push_back(v);
+    }
+    std::sort(seconds.begin(), seconds.end(), [this](int a, int b) { return matrix_[a] < matrix_[b]; });
+    parallelFor(n - 1, std::min(threadCount_, n - 1), [&](int index, int) {
+        int path[kBranchAndBoundLimit];
+        path[0] = 0;
+        path[1] = seconds[index];
+        long local_nodes = 0;
+        search.search(path, 2, 1 | (std::uint64_t(1) << path[1]), matrix_[path[1]], local_nodes);
+        search.nodes += local_nodes;
+    });
+
+    if (!search.bestOrder.empty()) {
+        order = search.bestOrder;
+    }
+    return !search.aborted;
+}
@@ -0,0 +1,61 @@
+#ifndef EXACT_SOLVER_H
+#define EXACT_SOLVER_H
+
+#include <vector>
+
+#include "Graph.h"
+#include "CancellationToken.h"
+
+// Résolution exacte des petites instances.
+// Jusqu'à kDynamicProgrammingLimit nœuds : programmation dynamique de Held et Karp sur
+// les sous-ensembles (O(2^N N²) opérations, O(2^N N) mémoire), couche par couche
+// (sous-ensembles de même taille) réparties entre threads.
+// Au-delà et jusqu'à kBranchAndBoundLimit nœuds : séparation et évaluation en
+// profondeur, évaluée par l'arbre couvrant minimal des nœuds restants pour les
+// distances pénalisées de la borne de Held-Karp, à partir d'une tournée connue.
+class ExactSolver {
+public:
+    // Au-delà, la séparation et évaluation est en pratique plus rapide (la table de la
+    // programmation dynamique occupe 2^(N-1) (N-1) entiers : 9 Mo à 18 nœuds)
+    static const int kDynamicProgrammingLimit = 18;
+    // Ensembles de nœuds visités codés sur 64 bits
+    static const int kBranchAndBoundLimit = 64;
+
+    // Constructeur : prend une référence constante au graphe
+    explicit ExactSolver(const Graph& graph);
+
+    void setThreadCount(int threads) { threadCount_ = threads; }
+
+    // Nombre maximal de nœuds explorés par la séparation et évaluation (0 : aucune limite)
+    void setNodeLimit(long nodes) { nodeLimit_ = nodes; }
+
+    // Jeton d'annulation : interrompt la séparation et évaluation comme la limite de nœuds
+    void setCancellation(const CancellationToken* token) { cancellation_ = token; }
+
+    // Programmation dynamique : remplit order avec une tournée optimale. Faux si
+    // l'instance dépasse kDynamicProgrammingLimit nœuds ou si les longueurs de
+    // chemins risquent de dépasser la capacité d'un int.
+    bool solveDynamicProgramming(std::vector<int>& order) const;
+
+    // Séparation et évaluation à partir de la tournée order (borne supérieure initiale),
+    // remplacée par toute tournée plus courte trouvée. Vrai si l'optimalité de order est
+    // prouvée ; faux si la limite de nœuds a interrompu la recherche ou si l'instance
+    // dépasse kBranchAndBoundLimit nœuds.
+    bool solveBranchAndBound(std::vector<int>& order) const;
+
+private:
+    const Graph& graph_;
+    int dimension_;
+    int threadCount_;
+    long nodeLimit_;
+    const CancellationToken* cancellation_ = nullptr;
+    std::vector<int> matrix_; // Copie dense des distances (au plus 64 × 64)
+
+    // Longueur de la tournée order
+    long tourLength(const std::vector<int>& order) const;
+
+    ExactSolver(const ExactSolver&) = delete;
+    ExactSolver& operator=(const ExactSolver&) = delete;
+};
+
+#endif
@@ -0,0 +1,78 @@
+#include "Geometry.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#define TSP_HAVE_AVX2_KERNEL 1
+#endif
+
+// Noyau scalaire : mêmes formules que euclideanDistance et attDistance
+static void computeDistancesScalar(const double* xs, const double* ys, int count, double x, double y,
+                                   CoordMetric metric, int* out) {
+    if (metric == CoordMetric::Att) {
+        for (int j = 0; j < count; ++j) {
+            double dx = x - xs[j];
+            double dy = y - ys[j];
+            double dist = std::sqrt((dx * dx + dy * dy) / 10.0);
+            double rounded = std::round(dist);
+            out[j] = static_cast<int>(rounded < dist ? rounded + 1.0 : rounded);
+        }
+    } else {
+        for (int j = 0; j < count; ++j) {
+            double dx = x - xs[j];
+            double dy = y - ys[j];
+            out[j] = static_cast<int>(std::round(std::sqrt(dx * dx + dy * dy)));
+        }
+    }
+}
+
+#ifdef TSP_HAVE_AVX2_KERNEL
+// Noyau AVX2 : 4 distances par itération.
+// Aucune FMA (dx * dx + dy * dy reste arrondi deux fois, comme en scalaire) et
+// sqrt / division IEEE : les valeurs sont identiques bit à bit au noyau scalaire.
+// std::round arrondit les demis loin de zéro : pour v >= 0, round(v) = floor(v) + (v - floor(v) >= 0.5),
+// la soustraction étant exacte.
+__attribute__((target("avx2")))
+static void computeDistancesAvx2(const double* xs, const double* ys, int count, double x, double y,
+                                 CoordMetric metric, int* out) {
+    const __m256d vx = _mm256_set1_pd(x);
+    const __m256d vy = _mm256_set1_pd(y);
+    const __m256d ten = _mm256_set1_pd(10.0);
+    const __m256d half = _mm256_set1_pd(0.5);
+    const __m256d one = _mm256_set1_pd(1.0);
+    const bool att = (metric == CoordMetric::Att);
+
+    int j = 0;
+    for (; j + 4 <= count; j += 4) {
+        __m256d dx = _mm256_sub_pd(vx, _mm256_loadu_pd(xs + j));
+        __m256d dy = _mm256_sub_pd(vy, _mm256_loadu_pd(ys + j));
+        __m256d sum = _mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy));
+        if (att) {
+            sum = _mm256_div_pd(sum, ten);
+        }
+        __m256d dist = _mm256_sqrt_pd(sum);
+        __m256d floor = _mm256_floor_pd(dist);
+        __m256d up = _mm256_cmp_pd(_mm256_sub_pd(dist, floor), half, _CMP_GE_OQ);
+        __m256d rounded = _mm256_add_pd(floor, _mm256_and_pd(up, one));
+        if (att) {
+            // ATT : un arrondi inférieur à la distance réelle est augmenté de 1
+            __m256d below = _mm256_cmp_pd(rounded, dist, _CMP_LT_OQ);
+            rounded = _mm256_add_pd(rounded, _mm256_and_pd(below, one));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + j), _mm256_cvttpd_epi32(rounded));
+    }
+    computeDistancesScalar(xs + j, ys + j, count - j, x, y, metric, out + j);
+}
+#endif
+
+// Calcule les distances d'un point à un bloc de points (SoA)
+void computeDistances(const double* xs, const double* ys, int count, double x, double y,
+                      CoordMetric metric, int* out) {
+#ifdef TSP_HAVE_AVX2_KERNEL
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    if (has_avx2) {
+        computeDistancesAvx2(xs, ys, count, x, y, metric, out);
+        return;
+    }
+#endif
+    computeDistancesScalar(xs, ys, count, x, y, metric, out);
+}
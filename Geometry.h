@@ -0,0 +1,49 @@
+#ifndef GEOMETRY_H
+#define GEOMETRY_H
+
+#include <cmath> // Pour sqrt et round
+
+// Structure pour stocker les coordonnées d'un nœud
+struct Point {
+    double x;
+    double y;
+};
+
+// Fonctions de distance calculables à partir des coordonnées (EDGE_WEIGHT_TYPE)
+enum class CoordMetric {
+    Euc2d, // Distance euclidienne 2D arrondie
+    Att    // Pseudo-distance euclidienne ATT
+};
+
+// Calcule la distance euclidienne 2D (arrondie)
+inline int euclideanDistance(const Point& p1, const Point& p2) {
+    double dx = p1.x - p2.x;
+    double dy = p1.y - p2.y;
+    double dist = std::sqrt(dx * dx + dy * dy);
+    return static_cast<int>(std::round(dist));
+}
+
+// Calcule la distance pour EDGE_WEIGHT_TYPE = ATT
+// Pseudo-distance euclidienne arrondie à l'entier le plus proche, puis augmentée
+// de 1 si cet arrondi est inférieur à la distance réelle (documentation page 6&7)
+inline int attDistance(const Point& p1, const Point& p2) {
+    double dx = p1.x - p2.x;
+    double dy = p1.y - p2.y;
+    double dist = std::sqrt((dx * dx + dy * dy) / 10.0);
+    double rounded = std::round(dist);
+    return static_cast<int>(rounded < dist ? rounded + 1.0 : rounded);
+}
+
+// Calcule la distance entre deux points selon la métrique
+inline int coordDistance(const Point& p1, const Point& p2, CoordMetric metric) {
+    return metric == CoordMetric::Att ? attDistance(p1, p2) : euclideanDistance(p1, p2);
+}
+
+// Calcule out[j] = d((x, y), (xs[j], ys[j])) pour j = 0..count-1, à partir de
+// coordonnées rangées en tableaux séparés (SoA). Utilise AVX2 quand le processeur
+// le permet, sinon une boucle scalaire ; les deux donnent exactement les mêmes
+// valeurs que euclideanDistance / attDistance (arrondi TSPLIB compris).
+void computeDistances(const double* xs, const double* ys, int count, double x, double y,
+                      CoordMetric metric, int* out);
+
+#endif
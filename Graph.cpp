@@ -1,22 +1,99 @@
 #include "Graph.h"
 #include <iomanip> // Pour std::setw
+#include <utility> // Pour std::move
+#include <algorithm> // Pour std::minmax_element
 
 // Constructeur
-Graph::Graph(int dimension, const std::vector<std::vector<int>>& distanceMatrix)
-    : dimension_(dimension), distanceMatrix_(distanceMatrix) {
-    // Les données sont copiées ici par le constructeur de copie de std::vector
-    // lors de l'initialisation de distanceMatrix_.
+Graph::Graph(int dimension, std::vector<int>&& distanceMatrix, MatrixLayout layout)
+    : dimension_(dimension), mode_(DistanceMode::Matrix), layout_(layout) {
+    // Le tampon est déplacé : le parser n'en garde plus de copie.
+    std::shared_ptr<std::vector<int>> storage = std::make_shared<std::vector<int>>(std::move(distanceMatrix));
+    if (storage->size() != matrixStorageSize(dimension_, layout_)) {
+        std::cerr << "Erreur: Taille de la matrice de distances incohérente avec la dimension " << dimension_ << std::endl;
+    }
+    distances_ = storage->data();
+    distanceStorage_ = std::move(storage);
+}
+
+// Constructeur sur une matrice externe
+Graph::Graph(int dimension, std::shared_ptr<const void> storage, const void* distances, WeightType weightType,
+             MatrixLayout layout)
+    : dimension_(dimension), mode_(DistanceMode::Matrix), layout_(layout), weightType_(weightType),
+      distances_(distances), distanceStorage_(std::move(storage)) {
+}
+
+namespace {
+// Copie la matrice d'entiers dans un tampon de poids plus étroits
+template <typename Weight>
+std::shared_ptr<const void> narrowCopy(const int* source, std::size_t size, const void*& data) {
+    std::shared_ptr<std::vector<Weight>> storage = std::make_shared<std::vector<Weight>>(size);
+    Weight* target = storage->data();
+    for (std::size_t k = 0; k < size; ++k) {
+        target[k] = static_cast<Weight>(source[k]);
+    }
+    data = target;
+    return storage;
 }
+} // namespace
+
+// Remplace la matrice d'entiers par le type de poids le plus étroit possible
+bool Graph::narrowWeights() {
+    if (mode_ != DistanceMode::Matrix || weightType_ != WeightType::Int32 || !distances_) {
+        return false;
+    }
+    const int* source = static_cast<const int*>(distances_);
+    std::size_t size = matrixStorageSize(dimension_, layout_);
+    if (size == 0) {
+        return false;
+    }
+    auto bounds = std::minmax_element(source, source + size);
+    WeightType narrowed = narrowestWeightType(*bounds.first, *bounds.second);
+    if (narrowed == WeightType::Int32) {
+        return false;
+    }
+    // L'ancienne matrice est libérée dès que distanceStorage_ est remplacé
+    const void* data = nullptr;
+    distanceStorage_ = narrowed == WeightType::UInt16 ? narrowCopy<std::uint16_t>(source, size, data)
+                                                      : narrowCopy<std::uint8_t>(source, size, data);
+    distances_ = data;
+    weightType_ = narrowed;
+    return true;
+}
+
+// Constructeur pour le mode coordonnées
+Graph::Graph(std::vector<Point>&& nodeCoords, CoordMetric metric)
+    : dimension_(static_cast<int>(nodeCoords.size())), mode_(DistanceMode::Coordinates),
+      layout_(MatrixLayout::Full), metric_(metric), nodeCoords_(std::move(nodeCoords)) {}
 
 // Destructeur
 Graph::~Graph() {
 }
 
+// Associe les coordonnées des nœuds à un graphe en mode Matrix
+void Graph::setNodeCoords(std::vector<Point>&& nodeCoords) {
+    if (mode_ != DistanceMode::Matrix || static_cast<int>(nodeCoords.size()) != dimension_) {
+        std::cerr << "Erreur: Coordonnées incompatibles avec le graphe." << std::endl;
+        return;
+    }
+    nodeCoords_ = std::move(nodeCoords);
+}
+
+// Construit les listes des k plus proches voisins de chaque nœud
+void Graph::buildCandidateLists(int k) {
+    TSP_STATS_TIMER(Candidates);
+    candidates_ = CandidateSet::build(*this, k);
+}
+
+// Remplace les listes de candidats
+void Graph::setCandidates(CandidateSet&& candidates) {
+    candidates_ = std::move(candidates);
+}
+
 // Obtient la distance entre deux nœuds
 int Graph::getDistance(int i, int j) const {
     // Simple vérification des valeurs
     if (i >= 0 && i < dimension_ && j >= 0 && j < dimension_) {
-        return distanceMatrix_[i][j];
+        return distance(i, j);
     } else {
         std::cerr << "Erreur: Accès hors limites à la matrice de distances (" << i << ", " << j << ")" << std::endl;
         return -1;
@@ -28,7 +105,7 @@ void Graph::printDistanceMatrix() const {
     std::cout << "Matrice de distances (" << dimension_ << "x" << dimension_ << "):" << std::endl;
     for (int i = 0; i < dimension_; ++i) {
         for (int j = 0; j < dimension_; ++j) {
-            std::cout << std::setw(5) << distanceMatrix_[i][j] << " "; // std::setw pour aligner
+            std::cout << std::setw(5) << distance(i, j) << " "; // std::setw pour aligner
         }
         std::cout << std::endl;
     }
@@ -3,27 +3,105 @@
 
 #include <vector>
 #include <iostream>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+#include "MatrixLayout.h"
+#include "Geometry.h"
+#include "CandidateSet.h"
+#include "Stats.h"
+
+// Origine des distances du graphe
+enum class DistanceMode {
+    Matrix,      // Matrice de distances précalculée
+    Coordinates  // Distances calculées à la demande à partir des coordonnées
+};
 
 class Graph {
 public:
-    // Constructeur prenant la dimension et la matrice de distances
-    Graph(int dimension, const std::vector<std::vector<int>>& distanceMatrix);
-    
+    // Constructeur prenant la dimension et la matrice de distances (tampon plat)
+    // La matrice est déplacée dans le graphe : aucune copie n'est effectuée.
+    Graph(int dimension, std::vector<int>&& distanceMatrix, MatrixLayout layout = MatrixLayout::Full);
+
+    // Constructeur sur une matrice externe (par exemple projetée en mémoire depuis un
+    // cache) : le graphe lit directement distances (poids de type weightType), que
+    // storage maintient en vie.
+    Graph(int dimension, std::shared_ptr<const void> storage, const void* distances, WeightType weightType,
+          MatrixLayout layout);
+
+    // Constructeur pour le mode coordonnées : seule la liste des points est conservée
+    // (mémoire en O(N)), chaque distance est recalculée à la demande
+    Graph(std::vector<Point>&& nodeCoords, CoordMetric metric);
+
     // Destructeur
     ~Graph();
 
     // Getters pour accéder aux données du graphe
     int getDimension() const { return dimension_; }
+    DistanceMode getDistanceMode() const { return mode_; }
+    MatrixLayout getLayout() const { return layout_; }
+    WeightType getWeightType() const { return weightType_; }
+    CoordMetric getCoordMetric() const { return metric_; }
+    const std::vector<Point>& getNodeCoords() const { return nodeCoords_; }
+
+    // Tampon de la matrice (disposition getLayout(), poids de type getWeightType()),
+    // nullptr en mode coordonnées
+    const void* getDistanceData() const { return distances_; }
+
+    // Remplace une matrice d'entiers par le type de poids le plus étroit qui contient
+    // toutes les distances (uint16 ou uint8). Retourne vrai si la matrice a été réduite.
+    bool narrowWeights();
 
-    // Obtient la distance entre deux nœuds
+    // Associe les coordonnées des nœuds à un graphe en mode Matrix
+    // (informations géométriques uniquement : les distances restent celles de la matrice)
+    void setNodeCoords(std::vector<Point>&& nodeCoords);
+
+    // Construit les listes des k plus proches voisins de chaque nœud
+    void buildCandidateLists(int k);
+
+    // Remplace les listes de candidats (par exemple lues depuis un cache)
+    void setCandidates(CandidateSet&& candidates);
+
+    // Listes de candidats (vides si buildCandidateLists n'a pas été appelé)
+    const CandidateSet& getCandidates() const { return candidates_; }
+
+    // Obtient la distance entre deux nœuds (avec vérification des indices)
     int getDistance(int i, int j) const;
 
+    // Obtient la distance entre deux nœuds sans vérification des indices
+    // Réservé aux boucles critiques du solveur, où les indices sont déjà valides.
+    int distance(int i, int j) const {
+        TSP_STATS_ADD(DistanceLookups, 1);
+        if (mode_ == DistanceMode::Matrix) {
+            std::size_t index = matrixIndex(i, j, dimension_, layout_);
+            switch (weightType_) {
+            case WeightType::UInt16:
+                return static_cast<const std::uint16_t*>(distances_)[index];
+            case WeightType::UInt8:
+                return static_cast<const std::uint8_t*>(distances_)[index];
+            default:
+                return static_cast<const int*>(distances_)[index];
+            }
+        }
+        return coordDistance(nodeCoords_[i], nodeCoords_[j], metric_);
+    }
+
     // Affiche la matrice de distances
     void printDistanceMatrix() const;
 
 private:
     int dimension_;
-    std::vector<std::vector<int>> distanceMatrix_;
+    DistanceMode mode_;
+    MatrixLayout layout_;
+    WeightType weightType_ = WeightType::Int32;
+    const void* distances_ = nullptr;            // Matrice stockée dans un seul tampon contigu
+    std::shared_ptr<const void> distanceStorage_; // Propriétaire du tampon (vecteur ou fichier projeté)
+
+    CoordMetric metric_ = CoordMetric::Euc2d;
+    std::vector<Point> nodeCoords_; // Coordonnées des nœuds (vide pour EXPLICIT)
+
+    CandidateSet candidates_; // k plus proches voisins de chaque nœud
 
     Graph(const Graph&) = delete;
     Graph& operator=(const Graph&) = delete;
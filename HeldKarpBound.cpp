@@ -0,0 +1,463 @@
+#include "HeldKarpBound.h"
+#include <algorithm> // Pour std::sort, std::unique, std::nth_element, std::max, std::min
+#include <cmath>     // Pour std::ceil, std::fabs
+#include <functional> // Pour std::greater
+#include <limits>
+#include <queue>
+#include <utility>   // Pour std::pair, std::move
+
+#include "DistancePolicy.h"
+#include "Parallel.h"
+#include "Stats.h"
+
+// Jusqu'à cette dimension, l'ascension elle-même se fait sur le graphe complet
+static const int kDenseAscentLimit = 1000;
+
+// Voisins par nœud (au moins) du graphe de l'ascension : avec trop peu d'arêtes, le
+// graphe peut ne pas contenir de tournée et les pénalités divergent
+static const int kAscentCandidates = 10;
+
+// Nombre maximal de 1-arbres calculés par défaut pendant l'ascension
+static const int kDefaultIterations = 1000;
+
+// Bornes de la longueur de la première période de l'ascension (N / 2 entre les deux)
+static const int kMinPeriod = 100;
+static const int kMaxPeriod = 500;
+
+namespace {
+
+const double kInfinity = std::numeric_limits<double>::infinity();
+
+// Deux arêtes les plus courtes (avec pénalités) du nœud 0 vers les nœuds 1..n-1
+template <typename Distance>
+void specialEdges(int n, const double* pi, const Distance& dist, int& first, double& firstCost,
+                  int& second, double& secondCost) {
+    first = second = -1;
+    firstCost = secondCost = kInfinity;
+    for (int v = 1; v < n; ++v) {
+        double c = dist(0, v) + pi[0] + pi[v];
+        if (c < firstCost) {
+            second = first;
+            secondCost = firstCost;
+            first = v;
+            firstCost = c;
+        } else if (c < secondCost) {
+            second = v;
+            secondCost = c;
+        }
+    }
+}
+
+// 1-arbre minimal sur le graphe complet : Prim en O(N²) sur les nœuds 1..n-1,
+// puis les deux arêtes les plus courtes du nœud 0. Retourne longueur - 2 Σ π.
+template <typename Distance>
+double denseOneTreeWith(int n, const double* pi, const Distance& dist, int* degree, int* parent, int* order) {
+    std::vector<double> key(n, kInfinity);
+    std::vector<char> in_tree(n, 0);
+    std::fill(degree, degree + n, 0);
+    double length = 0.0;
+
+    parent[0] = -1;
+    parent[1] = -1;
+    int u = 1;
+    for (int step = 0; step < n - 1; ++step) {
+        in_tree[u] = 1;
+        order[step] = u;
+        if (parent[u] >= 0) {
+            length += key[u];
+            ++degree[u];
+            ++degree[parent[u]];
+        }
+        // Mise à jour des clés et choix du nœud suivant dans la même passe
+        int next = -1;
+        double next_key = kInfinity;
+        for (int v = 1; v < n; ++v) {
+            if (in_tree[v]) {
+                continue;
+            }
+            double c = dist(u, v) + pi[u] + pi[v];
+            if (c < key[v]) {
+                key[v] = c;
+                parent[v] = u;
+            }
+            if (key[v] < next_key) {
+                next_key = key[v];
+                next = v;
+            }
+        }
+        u = next;
+    }
+
+    int first, second;
+    double first_cost, second_cost;
+    specialEdges(n, pi, dist, first, first_cost, second, second_cost);
+    length += first_cost + second_cost;
+    degree[0] = 2;
+    ++degree[first];
+    ++degree[second];
+
+    double penalty_sum = 0.0;
+    for (int i = 0; i < n; ++i) {
+        penalty_sum += pi[i];
+    }
+    return length - 2.0 * penalty_sum;
+}
+
+// Candidat d'une ligne : α, puis distance pour départager
+struct AlphaEntry {
+    double alpha;
+    int distance;
+    int node;
+    bool operator<(const AlphaEntry& other) const {
+        if (alpha != other.alpha) {
+            return alpha < other.alpha;
+        }
+        return distance < other.distance || (distance == other.distance && node < other.node);
+    }
+};
+
+// α-proximités : pour chaque nœud i, β(i, j) est la plus longue arête du chemin de i à j
+// dans l'arbre ; elle s'obtient pour tous les j en une passe dans l'ordre d'insertion
+// (chaque parent avant ses enfants), après avoir marqué le chemin de i à la racine.
+// α(i, j) = c(i, j) - β(i, j) ; pour le nœud 0, α(0, j) = c(0, j) - sa deuxième arête.
+template <typename Distance>
+void alphaListsWith(int n, int k, int threads, const double* pi, const std::vector<int>& parent,
+                    const std::vector<int>& order, const Distance& dist, std::vector<int>& neighbors) {
+    auto cost = [pi, &dist](int i, int j) { return dist(i, j) + pi[i] + pi[j]; };
+
+    std::vector<double> parent_cost(n, 0.0);
+    for (int j = 1; j < n; ++j) {
+        if (parent[j] >= 0) {
+            parent_cost[j] = cost(j, parent[j]);
+        }
+    }
+    int first, second;
+    double first_cost, second_cost;
+    specialEdges(n, pi, dist, first, first_cost, second, second_cost);
+
+    // Tampons propres à chaque thread
+    struct Buffers {
+        std::vector<double> beta;
+        std::vector<int> mark;
+        std::vector<AlphaEntry> entries;
+    };
+    threads = std::max(1, std::min(threads, n));
+    std::vector<Buffers> buffers(threads);
+    for (Buffers& buffer : buffers) {
+        buffer.beta.assign(n, 0.0);
+        buffer.mark.assign(n, -1);
+        buffer.entries.reserve(n);
+    }
+
+    parallelFor(n, threads, [&](int i, int worker) {
+        Buffers& buffer = buffers[worker];
+        std::vector<double>& beta = buffer.beta;
+        std::vector<int>& mark = buffer.mark;
+        std::vector<AlphaEntry>& entries = buffer.entries;
+        entries.clear();
+
+        if (i == 0) {
+            for (int j = 1; j < n; ++j) {
+                entries.push_back(AlphaEntry{std::max(0.0, cost(0, j) - second_cost), dist(0, j), j});
+            }
+        } else {
+            // Chemin de i à la racine
+            beta[i] = -kInfinity;
+            mark[i] = i;
+            for (int u = i; parent[u] >= 0; u = parent[u]) {
+                beta[parent[u]] = std::max(beta[u], parent_cost[u]);
+                mark[parent[u]] = i;
+            }
+            // Autres nœuds, parents d'abord
+            for (int t = 0; t < n - 1; ++t) {
+                int j = order[t];
+                if (mark[j] != i) {
+                    beta[j] = std::max(beta[parent[j]], parent_cost[j]);
+                }
+            }
+            entries.push_back(AlphaEntry{std::max(0.0, cost(i, 0) - second_cost), dist(i, 0), 0});
+            for (int j = 1; j < n; ++j) {
+                if (j != i) {
+                    entries.push_back(AlphaEntry{cost(i, j) - beta[j], dist(i, j), j});
+                }
+            }
+        }
+
+        std::nth_element(entries.begin(), entries.begin() + (k - 1), entries.end());
+        std::sort(entries.begin(), entries.begin() + k);
+        for (int c = 0; c < k; ++c) {
+            neighbors[static_cast<std::size_t>(i) * k + c] = entries[c].node;
+        }
+    });
+}
+
+} // namespace
+
+// Constructeur
+HeldKarpBound::HeldKarpBound(const Graph& graph) : graph_(graph), dimension_(graph.getDimension()) {
+}
+
+// Construit le graphe symétrisé des listes de candidats
+void HeldKarpBound::buildSparseGraph(const CandidateSet& candidates) {
+    int n = dimension_;
+    std::vector<std::vector<int>> lists(n);
+    for (int i = 0; i < n; ++i) {
+        for (const int* c = candidates.begin(i); c != candidates.end(i); ++c) {
+            lists[i].push_back(*c);
+            lists[*c].push_back(i);
+        }
+    }
+    adjacencyStart_.assign(n + 1, 0);
+    adjacency_.clear();
+    adjacencyCost_.clear();
+    for (int i = 0; i < n; ++i) {
+        std::vector<int>& list = lists[i];
+        std::sort(list.begin(), list.end());
+        list.erase(std::unique(list.begin(), list.end()), list.end());
+        for (int j : list) {
+            adjacency_.push_back(j);
+            adjacencyCost_.push_back(graph_.distance(i, j));
+        }
+        adjacencyStart_[i + 1] = static_cast<int>(adjacency_.size());
+        std::vector<int>().swap(list);
+    }
+}
+
+// 1-arbre minimal sur le graphe des candidats (Prim avec tas)
+bool HeldKarpBound::sparseOneTree(const std::vector<double>& pi, std::vector<int>& degree, double& value) const {
+    int n = dimension_;
+    std::vector<double> key(n, kInfinity);
+    std::vector<int> parent(n, -1);
+    std::vector<char> in_tree(n, 0);
+    std::fill(degree.begin(), degree.end(), 0);
+
+    typedef std::pair<double, int> HeapEntry;
+    std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<HeapEntry>> heap;
+    double length = 0.0;
+    int reached = 0;
+    key[1] = 0.0;
+    heap.push(HeapEntry(0.0, 1));
+    while (!heap.empty()) {
+        HeapEntry top = heap.top();
+        heap.pop();
+        int u = top.second;
+        if (in_tree[u] || top.first > key[u]) {
+            continue; // Entrée périmée
+        }
+        in_tree[u] = 1;
+        ++reached;
+        if (parent[u] >= 0) {
+            length += key[u];
+            ++degree[u];
+            ++degree[parent[u]];
+        }
+        for (int e = adjacencyStart_[u]; e < adjacencyStart_[u + 1]; ++e) {
+            int v = adjacency_[e];
+            if (v == 0 || in_tree[v]) {
+                continue;
+            }
+            double c = adjacencyCost_[e] + pi[u] + pi[v];
+            if (c < key[v]) {
+                key[v] = c;
+                parent[v] = u;
+                heap.push(HeapEntry(c, v));
+            }
+        }
+    }
+    if (reached != n - 1) {
+        return false;
+    }
+
+    // Nœud 0 : ses deux arêtes les plus courtes parmi ses candidats
+    int first = -1, second = -1;
+    double first_cost = kInfinity, second_cost = kInfinity;
+    for (int e = adjacencyStart_[0]; e < adjacencyStart_[1]; ++e) {
+        int v = adjacency_[e];
+        double c = adjacencyCost_[e] + pi[0] + pi[v];
+        if (c < first_cost) {
+            second = first;
+            second_cost = first_cost;
+            first = v;
+            first_cost = c;
+        } else if (c < second_cost) {
+            second = v;
+            second_cost = c;
+        }
+    }
+    if (second < 0) {
+        return false;
+    }
+    length += first_cost + second_cost;
+    degree[0] = 2;
+    ++degree[first];
+    ++degree[second];
+
+    double penalty_sum = 0.0;
+    for (int i = 0; i < n; ++i) {
+        penalty_sum += pi[i];
+    }
+    value = length - 2.0 * penalty_sum;
+    return true;
+}
+
+// 1-arbre minimal sur le graphe complet
+double HeldKarpBound::denseOneTree(const std::vector<double>& pi, std::vector<int>& degree,
+                                   std::vector<int>* parent, std::vector<int>* order) const {
+    int n = dimension_;
+    std::vector<int> local_parent;
+    std::vector<int> local_order;
+    if (!parent) {
+        parent = &local_parent;
+    }
+    if (!order) {
+        order = &local_order;
+    }
+    parent->resize(n);
+    order->resize(n - 1);
+    double value = 0.0;
+    withDistancePolicy(graph_, [&](const auto& dist) {
+        value = denseOneTreeWith(n, pi.data(), dist, degree.data(), parent->data(), order->data());
+    });
+    return value;
+}
+
+// Ascension par sous-gradient
+// Pas et périodes suivent le schéma de Held et Karp repris par LKH : le pas double tant
+// que la borne progresse pendant la phase initiale, puis pas et période sont divisés
+// par deux à chaque fin de période. La direction mélange le sous-gradient courant
+// (degré - 2) et le précédent (0,7 / 0,3) pour amortir les oscillations.
+bool HeldKarpBound::compute(int maxIterations) {
+    TSP_STATS_TIMER(LowerBound);
+    int n = dimension_;
+    lowerBound_ = 0;
+    validated_ = false;
+    tourFound_ = false;
+    iterations_ = 0;
+    penalties_.assign(n, 0.0);
+    if (n < 3) {
+        lowerBound_ = n == 2 ? 2L * graph_.distance(0, 1) : 0;
+        validated_ = true;
+        tourFound_ = true;
+        return true;
+    }
+    if (maxIterations <= 0) {
+        maxIterations = kDefaultIterations;
+    }
+
+    bool dense = n <= kDenseAscentLimit;
+    std::vector<int> degree(n, 0);
+    if (!dense) {
+        // Listes du graphe si elles sont assez longues, sinon listes propres à l'ascension
+        if (graph_.getCandidates().getK() >= std::min(kAscentCandidates, n - 1)) {
+            buildSparseGraph(graph_.getCandidates());
+        } else {
+            buildSparseGraph(CandidateSet::build(graph_, kAscentCandidates));
+        }
+        double value;
+        // La connexité du graphe des candidats ne dépend pas des pénalités
+        if (!sparseOneTree(penalties_, degree, value)) {
+            if (n > kDenseLimit) {
+                std::cerr << "Erreur: Graphe des candidats non connexe, borne de Held-Karp impossible "
+                          << "(augmenter --candidates)." << std::endl;
+                return false;
+            }
+            dense = true;
+        }
+    }
+    auto one_tree = [&](const std::vector<double>& pi) {
+        double value = 0.0;
+        if (dense) {
+            value = denseOneTree(pi, degree, nullptr, nullptr);
+        } else {
+            sparseOneTree(pi, degree, value);
+        }
+        return value;
+    };
+
+    std::vector<double> pi(n, 0.0);
+    std::vector<double> best_pi = pi;
+    std::vector<int> last_direction(n, 0);
+    double best_value = -kInfinity;
+    double step = 1.0;
+    int period = std::min(kMaxPeriod, std::max(kMinPeriod, n / 2));
+    bool initial_phase = true;
+
+    while (period > 0 && iterations_ < maxIterations && !tourFound_) {
+        for (int p = 1; p <= period && iterations_ < maxIterations; ++p) {
+            double value = one_tree(pi);
+            ++iterations_;
+            if (value > best_value) {
+                best_value = value;
+                best_pi = pi;
+                if (initial_phase) {
+                    step *= 2.0;
+                }
+                if (p == period) {
+                    period *= 2; // Encore en progrès en fin de période : la prolonger
+                }
+            } else if (initial_phase && p > period / 2) {
+                // Fin de la phase initiale : le pas a dépassé l'échelle utile
+                initial_phase = false;
+                p = 0;
+                step = 0.75 * step;
+            }
+
+            long norm = 0;
+            for (int i = 0; i < n; ++i) {
+                int direction = degree[i] - 2;
+                norm += static_cast<long>(direction) * direction;
+            }
+            if (norm == 0) {
+                tourFound_ = true; // Le 1-arbre est une tournée : la borne est atteinte
+                break;
+            }
+            for (int i = 0; i < n; ++i) {
+                int direction = degree[i] - 2;
+                pi[i] += step * (0.7 * direction + 0.3 * last_direction[i]);
+                last_direction[i] = direction;
+            }
+        }
+        period /= 2;
+        step /= 2.0;
+    }
+    penalties_ = best_pi;
+
+    // Borne finale sur le graphe complet quand c'est possible : elle est alors garantie
+    double bound = best_value;
+    if (!dense && n <= kDenseLimit) {
+        bound = denseOneTree(penalties_, degree, nullptr, nullptr);
+        tourFound_ = std::all_of(degree.begin(), degree.end(), [](int d) { return d == 2; });
+        // Garde-fou : des pénalités ajustées sur le seul graphe des candidats peuvent
+        // dégrader la borne ; le 1-arbre sans pénalités reste alors meilleur
+        std::vector<double> zero(n, 0.0);
+        double plain = denseOneTree(zero, degree, nullptr, nullptr);
+        if (plain > bound) {
+            bound = plain;
+            penalties_ = zero;
+            tourFound_ = std::all_of(degree.begin(), degree.end(), [](int d) { return d == 2; });
+        }
+    }
+    validated_ = (n <= kDenseLimit);
+    // Marge pour les erreurs d'arrondi de la somme en double
+    lowerBound_ = static_cast<long>(std::ceil(bound - 1e-9 * std::fabs(bound) - 1e-6));
+    return true;
+}
+
+// Listes des k candidats de plus faible α-proximité
+CandidateSet HeldKarpBound::alphaCandidates(int k, int threads) const {
+    int n = dimension_;
+    if (n < 3 || n > kDenseLimit || k <= 0 || static_cast<int>(penalties_.size()) != n) {
+        return CandidateSet();
+    }
+    k = std::min(k, n - 1);
+    std::vector<int> degree(n);
+    std::vector<int> parent;
+    std::vector<int> order;
+    denseOneTree(penalties_, degree, &parent, &order);
+
+    std::vector<int> neighbors(static_cast<std::size_t>(n) * k);
+    withDistancePolicy(graph_, [&](const auto& dist) {
+        alphaListsWith(n, k, threads, penalties_.data(), parent, order, dist, neighbors);
+    });
+    return CandidateSet::fromLists(k, std::move(neighbors), false);
+}
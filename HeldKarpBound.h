@@ -0,0 +1,80 @@
+#ifndef HELD_KARP_BOUND_H
+#define HELD_KARP_BOUND_H
+
+#include <vector>
+
+#include "Graph.h"
+#include "CandidateSet.h"
+
+// Borne inférieure de Held-Karp : longueur maximale, sur des pénalités π des nœuds,
+// du 1-arbre minimal (arbre couvrant minimal des nœuds 1..N-1, plus les deux arêtes
+// les plus courtes du nœud 0) pour les distances d(i, j) + π(i) + π(j), moins 2 Σ π.
+// Toute tournée étant un 1-arbre, cette valeur minore la longueur optimale.
+// Les pénalités sont ajustées par sous-gradient (degré - 2 de chaque nœud), sur le
+// graphe des listes de candidats (au moins 10 voisins) au-delà de 1000 nœuds ; la borne finale est
+// recalculée sur le graphe complet tant que N ne dépasse pas kDenseLimit.
+class HeldKarpBound {
+public:
+    // Au-delà, ni borne validée sur le graphe complet ni α-proximités (calculs en O(N²))
+    static const int kDenseLimit = 10000;
+
+    // Constructeur : prend une référence constante au graphe
+    explicit HeldKarpBound(const Graph& graph);
+
+    // Ascension par sous-gradient, en au plus maxIterations 1-arbres (0 : valeur par défaut).
+    // Faux si la borne ne peut pas être calculée (graphe des candidats non connexe
+    // pour une instance de plus de kDenseLimit nœuds).
+    bool compute(int maxIterations = 0);
+
+    // Borne inférieure (entière : les longueurs des tournées le sont)
+    long getLowerBound() const { return lowerBound_; }
+
+    // Vrai si la borne a été calculée sur le graphe complet ; sinon elle provient du
+    // seul graphe des candidats et n'est qu'une estimation
+    bool isValidated() const { return validated_; }
+
+    // Vrai si le dernier 1-arbre était une tournée : la borne est alors optimale
+    bool isTourFound() const { return tourFound_; }
+
+    int getIterations() const { return iterations_; }
+    const std::vector<double>& getPenalties() const { return penalties_; }
+
+    // Listes des k candidats de plus faible α-proximité : α(i, j) est l'allongement du
+    // 1-arbre minimal (avec les pénalités) lorsqu'il doit contenir l'arête (i, j).
+    // Calcul en O(N²), réparti entre threads ; ensemble vide au-delà de kDenseLimit nœuds.
+    CandidateSet alphaCandidates(int k, int threads) const;
+
+    // Écart relatif (en %) d'une longueur de tournée à la borne
+    static double gapPercent(long length, long bound) {
+        return bound > 0 ? 100.0 * static_cast<double>(length - bound) / static_cast<double>(bound) : 0.0;
+    }
+
+private:
+    const Graph& graph_;
+    int dimension_;
+    std::vector<int> adjacencyStart_; // Graphe non orienté des candidats (format CSR)
+    std::vector<int> adjacency_;
+    std::vector<int> adjacencyCost_;
+    std::vector<double> penalties_;
+    long lowerBound_ = 0;
+    bool validated_ = false;
+    bool tourFound_ = false;
+    int iterations_ = 0;
+
+    // Construit le graphe symétrisé des listes de candidats
+    void buildSparseGraph(const CandidateSet& candidates);
+
+    // 1-arbre minimal sur le graphe des candidats : retourne sa longueur moins 2 Σ π
+    // et remplit degree ; faux si le graphe n'est pas connexe
+    bool sparseOneTree(const std::vector<double>& pi, std::vector<int>& degree, double& value) const;
+
+    // 1-arbre minimal sur le graphe complet (Prim en O(N²)) ; parent et order (ordre
+    // d'insertion des nœuds 1..N-1, chaque parent avant ses enfants) sont facultatifs
+    double denseOneTree(const std::vector<double>& pi, std::vector<int>& degree,
+                        std::vector<int>* parent, std::vector<int>* order) const;
+
+    HeldKarpBound(const HeldKarpBound&) = delete;
+    HeldKarpBound& operator=(const HeldKarpBound&) = delete;
+};
+
+#endif
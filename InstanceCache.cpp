@@ -0,0 +1,265 @@
+#include "InstanceCache.h"
+#include "Graph.h"
+#include "CandidateSet.h"
+#include <cstring>  // Pour std::memcmp, std::memcpy
+#include <cstdio>   // Pour std::rename, std::remove
+#include <fstream>
+#include <iostream>
+#include <utility>  // Pour std::move
+
+#include <sys/stat.h>
+#include <unistd.h> // Pour getpid
+
+// Version du format : à incrémenter à chaque changement de disposition du fichier
+static const std::uint32_t kCacheVersion = 2;
+static const char kCacheMagic[8] = {'T', 'S', 'P', 'C', 'A', 'C', 'H', 'E'};
+static const std::uint32_t kByteOrderMark = 0x01020304; // Détecte un cache d'une autre architecture
+static const std::uint64_t kSectionAlignment = 64;      // Alignement des tableaux dans le fichier
+
+// En-tête du fichier, suivi des tableaux aux positions indiquées
+struct InstanceCache::Header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byteOrder;
+    std::uint64_t contentHash;   // Empreinte FNV-1a du fichier d'instance
+    std::uint64_t sourceSize;    // Taille et date de modification de l'instance à l'écriture
+    std::int64_t sourceMtime;    // (en nanosecondes)
+    std::int32_t dimension;
+    std::uint32_t weightType;    // 0 : EXPLICIT, 1 : EUC_2D, 2 : ATT
+    std::uint32_t layout;        // 0 : Full, 1 : UpperTriangle
+    std::uint32_t hasMatrix;
+    std::int32_t candidateK;     // 0 : pas de listes de candidats
+    std::uint32_t weightBytes;   // Taille d'un poids de la matrice : 4 (int), 2 (uint16) ou 1 (uint8)
+    std::uint64_t coordsOffset;     // N Points (si weightType != 0)
+    std::uint64_t matrixOffset;     // matrixStorageSize(N, layout) poids (si hasMatrix)
+    std::uint64_t candidatesOffset; // N * candidateK entiers (si candidateK > 0)
+    std::uint64_t fileSize;
+};
+
+static_assert(sizeof(Point) == 2 * sizeof(double), "Point doit être stocké sans remplissage");
+
+namespace {
+
+// Taille et date de modification d'un fichier
+bool statFile(const std::string& filename, std::uint64_t& size, std::int64_t& mtime) {
+    struct stat info;
+    if (::stat(filename.c_str(), &info) != 0) {
+        return false;
+    }
+    size = static_cast<std::uint64_t>(info.st_size);
+    mtime = static_cast<std::int64_t>(info.st_mtim.tv_sec) * 1000000000 + info.st_mtim.tv_nsec;
+    return true;
+}
+
+// Empreinte FNV-1a 64 bits du contenu d'un fichier, par mots de 8 octets
+bool hashFile(const std::string& filename, std::uint64_t& hash) {
+    MappedFile file;
+    if (!file.open(filename)) {
+        return false;
+    }
+    const std::uint64_t prime = 0x100000001b3ULL;
+    hash = 0xcbf29ce484222325ULL;
+    const char* data = file.data();
+    std::size_t size = file.size();
+    std::size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        std::uint64_t word;
+        std::memcpy(&word, data + i, 8);
+        hash = (hash ^ word) * prime;
+    }
+    for (; i < size; ++i) {
+        hash = (hash ^ static_cast<unsigned char>(data[i])) * prime;
+    }
+    hash = (hash ^ size) * prime;
+    return true;
+}
+
+// Arrondit une position au multiple d'alignement suivant
+std::uint64_t alignOffset(std::uint64_t offset) {
+    return (offset + kSectionAlignment - 1) / kSectionAlignment * kSectionAlignment;
+}
+
+// Vrai si [offset, offset + bytes) tient dans le fichier
+bool sectionFits(std::uint64_t offset, std::uint64_t bytes, std::uint64_t fileSize) {
+    return offset <= fileSize && bytes <= fileSize - offset;
+}
+
+} // namespace
+
+// Ouvre le cache et vérifie qu'il correspond à l'instance
+bool InstanceCache::open(const std::string& cachePath, const std::string& instanceFile) {
+    file_.reset();
+    header_ = nullptr;
+
+    std::uint64_t source_size;
+    std::int64_t source_mtime;
+    if (!statFile(instanceFile, source_size, source_mtime)) {
+        return false;
+    }
+
+    std::shared_ptr<MappedFile> file = std::make_shared<MappedFile>();
+    if (!file->open(cachePath) || file->size() < sizeof(Header)) {
+        return false; // Pas encore de cache
+    }
+    const Header* header = reinterpret_cast<const Header*>(file->data());
+    if (std::memcmp(header->magic, kCacheMagic, sizeof(kCacheMagic)) != 0 ||
+        header->version != kCacheVersion || header->byteOrder != kByteOrderMark) {
+        return false;
+    }
+
+    // Cohérence des tableaux avec la taille du fichier
+    std::uint64_t size = file->size();
+    std::uint64_t n = static_cast<std::uint64_t>(header->dimension);
+    MatrixLayout layout = header->layout == 0 ? MatrixLayout::Full : MatrixLayout::UpperTriangle;
+    if (header->fileSize != size || header->dimension <= 0 || header->weightType > 2 || header->layout > 1 ||
+        header->candidateK < 0 || header->candidateK >= header->dimension ||
+        (header->weightBytes != 4 && header->weightBytes != 2 && header->weightBytes != 1)) {
+        return false;
+    }
+    if ((header->weightType != 0 && !sectionFits(header->coordsOffset, n * sizeof(Point), size)) ||
+        (header->hasMatrix && !sectionFits(header->matrixOffset, matrixStorageSize(header->dimension, layout) * header->weightBytes, size)) ||
+        (header->candidateK > 0 && !sectionFits(header->candidatesOffset, n * header->candidateK * sizeof(int), size))) {
+        return false;
+    }
+
+    // Instance modifiée depuis l'écriture : comparer le contenu
+    if (header->sourceSize != source_size || header->sourceMtime != source_mtime) {
+        std::uint64_t hash;
+        if (!hashFile(instanceFile, hash) || hash != header->contentHash) {
+            return false;
+        }
+    }
+
+    file_ = std::move(file);
+    header_ = header;
+    return true;
+}
+
+// Écrit le cache du graphe
+bool InstanceCache::write(const std::string& cachePath, const std::string& instanceFile,
+                          const Graph& graph, bool hasCoordinates, CoordMetric metric) {
+    Header header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, kCacheMagic, sizeof(kCacheMagic));
+    header.version = kCacheVersion;
+    header.byteOrder = kByteOrderMark;
+    if (!statFile(instanceFile, header.sourceSize, header.sourceMtime) ||
+        !hashFile(instanceFile, header.contentHash)) {
+        std::cerr << "Erreur: Impossible de lire " << instanceFile << " pour écrire le cache." << std::endl;
+        return false;
+    }
+
+    int n = graph.getDimension();
+    const void* matrix = graph.getDistanceData();
+    const CandidateSet& candidates = graph.getCandidates();
+    hasCoordinates = hasCoordinates && static_cast<int>(graph.getNodeCoords().size()) == n;
+
+    header.dimension = n;
+    header.weightType = !hasCoordinates ? 0 : (metric == CoordMetric::Att ? 2 : 1);
+    header.layout = graph.getLayout() == MatrixLayout::Full ? 0 : 1;
+    header.hasMatrix = matrix != nullptr;
+    header.weightBytes = static_cast<std::uint32_t>(weightSize(graph.getWeightType()));
+    header.candidateK = candidates.getK();
+
+    std::uint64_t coords_bytes = hasCoordinates ? static_cast<std::uint64_t>(n) * sizeof(Point) : 0;
+    std::uint64_t matrix_bytes = matrix ? matrixStorageSize(n, graph.getLayout()) * header.weightBytes : 0;
+    std::uint64_t candidates_bytes = static_cast<std::uint64_t>(n) * candidates.getK() * sizeof(int);
+    header.coordsOffset = alignOffset(sizeof(Header));
+    header.matrixOffset = alignOffset(header.coordsOffset + coords_bytes);
+    header.candidatesOffset = alignOffset(header.matrixOffset + matrix_bytes);
+    header.fileSize = header.candidatesOffset + candidates_bytes;
+
+    std::string temporary = cachePath + ".tmp." + std::to_string(::getpid());
+    std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        std::cerr << "Erreur: Impossible de créer le fichier de cache " << temporary << std::endl;
+        return false;
+    }
+
+    // Écrit un tableau à sa position, précédé du remplissage nécessaire
+    std::uint64_t written = 0;
+    auto write_at = [&](std::uint64_t offset, const void* data, std::uint64_t bytes) {
+        static const char zeros[kSectionAlignment] = {};
+        out.write(zeros, static_cast<std::streamsize>(offset - written));
+        out.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+        written = offset + bytes;
+    };
+    write_at(0, &header, sizeof(header));
+    if (coords_bytes > 0) {
+        write_at(header.coordsOffset, graph.getNodeCoords().data(), coords_bytes);
+    }
+    if (matrix_bytes > 0) {
+        write_at(header.matrixOffset, matrix, matrix_bytes);
+    }
+    if (candidates_bytes > 0) {
+        write_at(header.candidatesOffset, candidates.data(), candidates_bytes);
+    }
+    write_at(header.fileSize, nullptr, 0);
+    out.close();
+
+    if (!out || std::rename(temporary.c_str(), cachePath.c_str()) != 0) {
+        std::cerr << "Erreur: Écriture du cache " << cachePath << " impossible." << std::endl;
+        std::remove(temporary.c_str());
+        return false;
+    }
+    return true;
+}
+
+// Informations de l'en-tête
+int InstanceCache::getDimension() const {
+    return header_ ? header_->dimension : 0;
+}
+
+bool InstanceCache::hasCoordinates() const {
+    return header_ && header_->weightType != 0;
+}
+
+CoordMetric InstanceCache::getCoordMetric() const {
+    return header_ && header_->weightType == 2 ? CoordMetric::Att : CoordMetric::Euc2d;
+}
+
+// Vrai si le cache contient une matrice dans la disposition demandée
+bool InstanceCache::hasMatrix(MatrixLayout layout) const {
+    return header_ && header_->hasMatrix && header_->layout == (layout == MatrixLayout::Full ? 0u : 1u);
+}
+
+// Type des poids de la matrice en cache
+WeightType InstanceCache::getWeightType() const {
+    if (!header_) {
+        return WeightType::Int32;
+    }
+    return header_->weightBytes == 1 ? WeightType::UInt8
+                                     : (header_->weightBytes == 2 ? WeightType::UInt16 : WeightType::Int32);
+}
+
+// Nombre de candidats par nœud
+int InstanceCache::getCandidateK() const {
+    return header_ ? header_->candidateK : 0;
+}
+
+// Copie des coordonnées
+std::vector<Point> InstanceCache::getNodeCoords() const {
+    if (!hasCoordinates()) {
+        return std::vector<Point>();
+    }
+    const Point* coords = at<Point>(header_->coordsOffset);
+    return std::vector<Point>(coords, coords + header_->dimension);
+}
+
+// Graphe en mode Matrix lisant directement la matrice projetée
+std::unique_ptr<Graph> InstanceCache::createMatrixGraph() const {
+    if (!header_ || !header_->hasMatrix) {
+        return nullptr;
+    }
+    MatrixLayout layout = header_->layout == 0 ? MatrixLayout::Full : MatrixLayout::UpperTriangle;
+    return std::unique_ptr<Graph>(new Graph(header_->dimension, file_, at<char>(header_->matrixOffset),
+                                            getWeightType(), layout));
+}
+
+// Listes de candidats lues directement dans le fichier projeté
+CandidateSet InstanceCache::getCandidates() const {
+    if (!header_ || header_->candidateK == 0) {
+        return CandidateSet();
+    }
+    return CandidateSet::view(header_->candidateK, at<int>(header_->candidatesOffset), file_);
+}
@@ -0,0 +1,72 @@
+#ifndef INSTANCE_CACHE_H
+#define INSTANCE_CACHE_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+#include "Geometry.h"
+#include "MatrixLayout.h"
+#include "MappedFile.h"
+
+class Graph;
+class CandidateSet;
+
+// Cache binaire d'une instance prétraitée, écrit à côté du fichier TSPLIB
+// (« <instance>.cache ») : en-tête versionné, coordonnées, matrice de distances
+// plate et listes de candidats. Le fichier est projeté en mémoire et ses tableaux
+// sont utilisés tels quels : au lancement suivant, ni parsing ni copie de la matrice.
+// Le cache est associé au contenu de l'instance par une empreinte FNV-1a ; taille
+// et date de modification servent de raccourci pour éviter de relire l'instance.
+class InstanceCache {
+public:
+    // Chemin du cache associé à un fichier d'instance
+    static std::string sidecarPath(const std::string& instanceFile) { return instanceFile + ".cache"; }
+
+    // Ouvre le cache et vérifie qu'il correspond à l'instance ; faux s'il est absent,
+    // corrompu, d'une autre version ou périmé
+    bool open(const std::string& cachePath, const std::string& instanceFile);
+
+    // Écrit (ou remplace) le cache du graphe. Le fichier est écrit à côté puis renommé,
+    // pour qu'un lecteur concurrent ne voie jamais un cache incomplet.
+    static bool write(const std::string& cachePath, const std::string& instanceFile,
+                      const Graph& graph, bool hasCoordinates, CoordMetric metric);
+
+    // Informations de l'en-tête
+    int getDimension() const;
+    bool hasCoordinates() const;
+    CoordMetric getCoordMetric() const;
+
+    // Vrai si le cache contient une matrice dans la disposition demandée
+    bool hasMatrix(MatrixLayout layout) const;
+
+    // Type des poids de la matrice en cache (largeur choisie à l'écriture)
+    WeightType getWeightType() const;
+
+    // Nombre de candidats par nœud (0 : pas de listes)
+    int getCandidateK() const;
+
+    // Copie des coordonnées (O(N))
+    std::vector<Point> getNodeCoords() const;
+
+    // Graphe en mode Matrix lisant directement la matrice projetée
+    std::unique_ptr<Graph> createMatrixGraph() const;
+
+    // Listes de candidats lues directement dans le fichier projeté
+    CandidateSet getCandidates() const;
+
+private:
+    struct Header;
+
+    std::shared_ptr<MappedFile> file_; // Partagé avec les graphes et listes créés
+    const Header* header_ = nullptr;
+
+    // Pointeur vers un tableau du fichier
+    template <typename T>
+    const T* at(std::uint64_t offset) const {
+        return reinterpret_cast<const T*>(file_->data() + offset);
+    }
+};
+
+#endif
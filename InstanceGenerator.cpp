@@ -0,0 +1,206 @@
+#include "InstanceGenerator.h"
+#include <iostream>
+#include <random>
+#include <vector>
+#include <cmath>     // Pour std::sqrt et std::ceil
+#include <algorithm> // Pour std::min et std::max
+
+// Tampon d'écriture de taille fixe, vidé dans le fichier lorsqu'il est plein
+namespace {
+class OutputBuffer {
+public:
+    explicit OutputBuffer(std::FILE* file) : file_(file), buffer_(1 << 20), used_(0), ok_(true) {}
+
+    // Ajoute une chaîne
+    void append(const std::string& text) {
+        for (char c : text) {
+            put(c);
+        }
+    }
+
+    // Ajoute un entier positif ou nul en décimal
+    void appendNumber(long value) {
+        char digits[24];
+        int count = 0;
+        do {
+            digits[count++] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value > 0);
+        reserve(count);
+        while (count > 0) {
+            buffer_[used_++] = digits[--count];
+        }
+    }
+
+    // Ajoute un caractère
+    void put(char c) {
+        reserve(1);
+        buffer_[used_++] = c;
+    }
+
+    // Vide le tampon ; faux si une écriture a échoué
+    bool flush() {
+        if (used_ > 0 && std::fwrite(buffer_.data(), 1, used_, file_) != used_) {
+            ok_ = false;
+        }
+        used_ = 0;
+        return ok_;
+    }
+
+private:
+    std::FILE* file_;
+    std::vector<char> buffer_;
+    std::size_t used_;
+    bool ok_;
+
+    // Vide le tampon s'il ne reste pas count octets libres
+    void reserve(int count) {
+        if (used_ + static_cast<std::size_t>(count) > buffer_.size()) {
+            flush();
+        }
+    }
+};
+
+// PGCD (choix d'un multiplicateur premier avec la taille de la grille)
+unsigned long long gcd(unsigned long long a, unsigned long long b) {
+    while (b != 0) {
+        unsigned long long r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+} // namespace
+
+// Constructeur
+InstanceGenerator::InstanceGenerator(int dimension, Distribution distribution, unsigned long seed)
+    : dimension_(dimension), distribution_(distribution), seed_(seed) {}
+
+// Convertit un nom de répartition
+bool InstanceGenerator::parseDistribution(const std::string& name, Distribution& distribution) {
+    if (name == "uniform") {
+        distribution = Distribution::Uniform;
+    } else if (name == "clustered") {
+        distribution = Distribution::Clustered;
+    } else if (name == "grid") {
+        distribution = Distribution::Grid;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// Nom de la répartition
+const char* InstanceGenerator::distributionName(Distribution distribution) {
+    switch (distribution) {
+    case Distribution::Clustered:
+        return "clustered";
+    case Distribution::Grid:
+        return "grid";
+    default:
+        return "uniform";
+    }
+}
+
+// Écrit l'instance dans le fichier ("-" : sortie standard)
+bool InstanceGenerator::write(const std::string& filename) const {
+    if (dimension_ < 1 || range_ < 1) {
+        std::cerr << "Erreur : dimension ou étendue invalide" << std::endl;
+        return false;
+    }
+    if (filename == "-") {
+        return writeTo(stdout, "random");
+    }
+
+    std::FILE* file = std::fopen(filename.c_str(), "wb");
+    if (!file) {
+        std::cerr << "Erreur : impossible de créer " << filename << std::endl;
+        return false;
+    }
+    std::string name = filename.substr(filename.find_last_of('/') + 1);
+    bool ok = writeTo(file, name.substr(0, name.find('.')));
+    if (std::fclose(file) != 0) {
+        ok = false;
+    }
+    if (!ok) {
+        std::cerr << "Erreur : écriture de " << filename << " incomplète" << std::endl;
+    }
+    return ok;
+}
+
+// Écrit l'en-tête puis les coordonnées dans le flux
+bool InstanceGenerator::writeTo(std::FILE* file, const std::string& name) const {
+    OutputBuffer out(file);
+    out.append("NAME : " + name + "\n");
+    out.append("COMMENT : " + std::to_string(dimension_) + " " + distributionName(distribution_) +
+               " points, seed " + std::to_string(seed_) + "\n");
+    out.append("TYPE : TSP\n");
+    out.append("DIMENSION : " + std::to_string(dimension_) + "\n");
+    out.append("EDGE_WEIGHT_TYPE : EUC_2D\n");
+    out.append("NODE_COORD_SECTION\n");
+
+    std::mt19937_64 rng(seed_);
+    std::uniform_int_distribution<long> coordinate(0, range_ - 1);
+
+    // Nuages : centres uniformes, écart type proportionnel à l'espacement moyen des centres
+    int clusters = clusterCount_ > 0 ? clusterCount_ : std::max(1, dimension_ / 1000);
+    std::vector<long> centers;
+    std::normal_distribution<double> spread(0.0, range_ / (4.0 * std::sqrt(static_cast<double>(clusters))));
+    std::uniform_int_distribution<int> pickCenter(0, clusters - 1);
+    if (distribution_ == Distribution::Clustered) {
+        centers.resize(2 * static_cast<std::size_t>(clusters));
+        for (long& value : centers) {
+            value = coordinate(rng);
+        }
+    }
+
+    // Grille : side² cases, parcourues dans un ordre pseudo-aléatoire (i -> a·i + b mod side²,
+    // en sautant les cases au-delà de la dimension) pour que la numérotation ne donne pas
+    // déjà une bonne tournée
+    unsigned long long side = static_cast<unsigned long long>(std::ceil(std::sqrt(static_cast<double>(dimension_))));
+    while (side * side < static_cast<unsigned long long>(dimension_)) {
+        ++side;
+    }
+    unsigned long long cells = side * side;
+    unsigned long long multiplier = 1;
+    unsigned long long offset = 0;
+    long spacing = std::max<long>(1, range_ / static_cast<long>(side));
+    if (distribution_ == Distribution::Grid) {
+        multiplier = (rng() % cells) | 1;
+        while (gcd(multiplier, cells) != 1) {
+            multiplier += 2;
+        }
+        offset = rng() % cells;
+    }
+    unsigned long long cell = 0;
+
+    for (int i = 0; i < dimension_; ++i) {
+        long x;
+        long y;
+        if (distribution_ == Distribution::Clustered) {
+            int c = pickCenter(rng);
+            double dx = spread(rng);
+            double dy = spread(rng);
+            x = std::min(range_ - 1, std::max(0L, centers[2 * c] + static_cast<long>(dx)));
+            y = std::min(range_ - 1, std::max(0L, centers[2 * c + 1] + static_cast<long>(dy)));
+        } else if (distribution_ == Distribution::Grid) {
+            unsigned long long index;
+            do {
+                index = (multiplier * (cell++ % cells) + offset) % cells; // Bijection de [0, side²)
+            } while (index >= static_cast<unsigned long long>(dimension_));
+            x = static_cast<long>(index % side) * spacing;
+            y = static_cast<long>(index / side) * spacing;
+        } else {
+            x = coordinate(rng);
+            y = coordinate(rng);
+        }
+        out.appendNumber(i + 1);
+        out.put(' ');
+        out.appendNumber(x);
+        out.put(' ');
+        out.appendNumber(y);
+        out.put('\n');
+    }
+    out.append("EOF\n");
+    return out.flush() && std::fflush(file) == 0;
+}
@@ -0,0 +1,50 @@
+#ifndef INSTANCE_GENERATOR_H
+#define INSTANCE_GENERATOR_H
+
+#include <string>
+#include <cstdio>
+
+// Répartition des points d'une instance générée
+enum class Distribution {
+    Uniform,   // Points uniformes dans le carré
+    Clustered, // Nuages gaussiens autour de centres uniformes
+    Grid       // Grille régulière (nombreuses distances égales)
+};
+
+// Générateur d'instances TSPLIB EUC_2D synthétiques, à coordonnées entières
+// dans [0, range)². Les nœuds sont produits et écrits un par un dans un tampon
+// de taille fixe : la mémoire ne dépend pas de la dimension, ce qui permet
+// d'écrire des instances de plusieurs millions de nœuds.
+// Le résultat ne dépend que des paramètres et de la graine.
+class InstanceGenerator {
+public:
+    // Constructeur
+    InstanceGenerator(int dimension, Distribution distribution, unsigned long seed);
+
+    // Nombre de centres de la répartition Clustered (défaut : dimension / 1000, au moins 1)
+    void setClusterCount(int clusters) { clusterCount_ = clusters; }
+
+    // Côté du carré des coordonnées (défaut : 1 000 000)
+    void setRange(long range) { range_ = range; }
+
+    // Écrit l'instance dans le fichier ("-" : sortie standard) ; faux en cas d'échec
+    bool write(const std::string& filename) const;
+
+    // Convertit un nom ("uniform", "clustered", "grid") ; faux s'il est inconnu
+    static bool parseDistribution(const std::string& name, Distribution& distribution);
+
+    // Nom de la répartition
+    static const char* distributionName(Distribution distribution);
+
+private:
+    int dimension_;
+    Distribution distribution_;
+    unsigned long seed_;
+    int clusterCount_ = 0;
+    long range_ = 1000000;
+
+    // Écrit l'en-tête puis les coordonnées dans le flux
+    bool writeTo(std::FILE* file, const std::string& name) const;
+};
+
+#endif
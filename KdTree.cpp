@@ -0,0 +1,106 @@
+#include "KdTree.h"
+#include <algorithm> // Pour std::nth_element, std::push_heap, std::sort_heap
+
+// Nombre maximal de points dans une feuille
+static const int kLeafSize = 8;
+
+// Constructeur
+KdTree::KdTree(const std::vector<Point>& points) : points_(points), order_(points.size()) {
+    for (size_t i = 0; i < order_.size(); ++i) {
+        order_[i] = static_cast<int>(i);
+    }
+    nodes_.reserve(2 * order_.size() / kLeafSize + 1);
+    if (!order_.empty()) {
+        build(0, static_cast<int>(order_.size()));
+    }
+}
+
+// Construit récursivement le sous-arbre couvrant order_[begin, end)
+int KdTree::build(int begin, int end) {
+    int index = static_cast<int>(nodes_.size());
+    nodes_.push_back(Node{-1, 0.0, -1, -1, begin, end});
+    if (end - begin <= kLeafSize) {
+        return index;
+    }
+
+    // Couper selon l'axe le plus étendu
+    double min_x = points_[order_[begin]].x, max_x = min_x;
+    double min_y = points_[order_[begin]].y, max_y = min_y;
+    for (int i = begin + 1; i < end; ++i) {
+        const Point& p = points_[order_[i]];
+        min_x = std::min(min_x, p.x);
+        max_x = std::max(max_x, p.x);
+        min_y = std::min(min_y, p.y);
+        max_y = std::max(max_y, p.y);
+    }
+    int axis = (max_x - min_x >= max_y - min_y) ? 0 : 1;
+
+    // Partition autour de la médiane
+    int middle = begin + (end - begin) / 2;
+    const std::vector<Point>& points = points_;
+    std::nth_element(order_.begin() + begin, order_.begin() + middle, order_.begin() + end,
+                     [&points, axis](int a, int b) {
+                         return axis == 0 ? points[a].x < points[b].x : points[a].y < points[b].y;
+                     });
+    double split = axis == 0 ? points_[order_[middle]].x : points_[order_[middle]].y;
+
+    int left = build(begin, middle);
+    int right = build(middle, end);
+    Node& node = nodes_[index];
+    node.axis = axis;
+    node.split = split;
+    node.left = left;
+    node.right = right;
+    return index;
+}
+
+// Parcourt le sous-arbre en élaguant les branches trop éloignées
+void KdTree::search(int nodeIndex, int query, int k, std::vector<Neighbor>& heap) const {
+    const Node& node = nodes_[nodeIndex];
+    const Point& q = points_[query];
+
+    if (node.axis < 0) {
+        for (int i = node.begin; i < node.end; ++i) {
+            int candidate = order_[i];
+            if (candidate == query) {
+                continue;
+            }
+            double dx = points_[candidate].x - q.x;
+            double dy = points_[candidate].y - q.y;
+            Neighbor neighbor{dx * dx + dy * dy, candidate};
+            if (static_cast<int>(heap.size()) < k) {
+                heap.push_back(neighbor);
+                std::push_heap(heap.begin(), heap.end());
+            } else if (neighbor < heap.front()) {
+                std::pop_heap(heap.begin(), heap.end());
+                heap.back() = neighbor;
+                std::push_heap(heap.begin(), heap.end());
+            }
+        }
+        return;
+    }
+
+    // Descendre d'abord du côté de la requête, puis de l'autre si la boule le touche
+    double diff = (node.axis == 0 ? q.x : q.y) - node.split;
+    int nearSide = diff < 0 ? node.left : node.right;
+    int farSide = diff < 0 ? node.right : node.left;
+    search(nearSide, query, k, heap);
+    if (static_cast<int>(heap.size()) < k || diff * diff <= heap.front().distance2) {
+        search(farSide, query, k, heap);
+    }
+}
+
+// Remplit result avec les k plus proches voisins du nœud i
+void KdTree::nearest(int i, int k, std::vector<int>& result) const {
+    result.clear();
+    if (nodes_.empty() || k <= 0) {
+        return;
+    }
+    std::vector<Neighbor> heap;
+    heap.reserve(k + 1);
+    search(0, i, k, heap);
+    std::sort_heap(heap.begin(), heap.end());
+    for (const Neighbor& neighbor : heap) {
+        result.push_back(neighbor.node);
+    }
+}
@@ -0,0 +1,51 @@
+#ifndef KD_TREE_H
+#define KD_TREE_H
+
+#include <vector>
+
+#include "Geometry.h"
+
+// Arbre k-d (k = 2) sur les coordonnées des nœuds.
+// Sert à trouver les plus proches voisins géométriques en O(log N) par requête,
+// sans jamais consulter de matrice de distances.
+class KdTree {
+public:
+    // Construit l'arbre en O(N log N) ; les points doivent survivre à l'arbre
+    explicit KdTree(const std::vector<Point>& points);
+
+    // Remplit result avec les k plus proches voisins du nœud i (i exclu),
+    // triés par distance euclidienne croissante
+    void nearest(int i, int k, std::vector<int>& result) const;
+
+private:
+    // Nœud interne (axis >= 0) ou feuille (axis < 0, plage [begin, end) de order_)
+    struct Node {
+        int axis;
+        double split;
+        int left;
+        int right;
+        int begin;
+        int end;
+    };
+
+    // Candidat conservé pendant une recherche (tas max sur la distance)
+    struct Neighbor {
+        double distance2;
+        int node;
+        bool operator<(const Neighbor& other) const {
+            return distance2 < other.distance2 || (distance2 == other.distance2 && node < other.node);
+        }
+    };
+
+    const std::vector<Point>& points_;
+    std::vector<int> order_; // Permutation des nœuds, regroupés par feuille
+    std::vector<Node> nodes_;
+
+    // Construit récursivement le sous-arbre couvrant order_[begin, end)
+    int build(int begin, int end);
+
+    // Parcourt le sous-arbre en élaguant les branches trop éloignées
+    void search(int nodeIndex, int query, int k, std::vector<Neighbor>& heap) const;
+};
+
+#endif
@@ -0,0 +1,179 @@
+#include "LinKernighan.h"
+#include <algorithm> // Pour std::sort, std::min
+#include "Stats.h"
+
+// Profondeur maximale d'une suite de mouvements (mouvement séquentiel en 5 étapes)
+static const int kMaxDepth = 5;
+
+// Nombre d'alternatives essayées à chaque profondeur (1 au-delà)
+static const int kBreadth[] = {5, 3, 1, 1, 1};
+
+// Constructeur
+LinKernighan::LinKernighan(const Graph& graph)
+    : graph_(graph), active_(graph.getDimension(), 0), alternatives_(kMaxDepth) {
+    if (graph_.getCandidates().empty()) {
+        allNodes_.resize(graph_.getDimension());
+        for (int i = 0; i < graph_.getDimension(); ++i) {
+            allNodes_[i] = i;
+        }
+    }
+    // Une étape retient au plus un t3 par voisin examiné de t2
+    int neighbours = graph_.getCandidates().empty() ? graph_.getDimension() : graph_.getCandidates().getK();
+    for (std::vector<Alternative>& alternatives : alternatives_) {
+        alternatives.reserve(neighbours);
+    }
+}
+
+// Active un nœud
+void LinKernighan::activate(int node) {
+    if (!active_[node]) {
+        active_[node] = 1;
+        queue_.push_back(node);
+    }
+}
+
+// Applique une inversion et l'enregistre
+void LinKernighan::applyFlip(int a, int b, int c, int d) {
+    list_->flip(a, b, c, d);
+    flips_.push_back(Flip{a, b, c, d});
+}
+
+// Annule les inversions jusqu'à n'en garder que count
+void LinKernighan::undoFlips(size_t count) {
+    while (flips_.size() > count) {
+        const Flip& flip = flips_.back();
+        // flip(a, b, c, d) a ajouté (a, c) et (b, d) : l'inverse les retire
+        list_->flip(flip.a, flip.c, flip.b, flip.d);
+        flips_.pop_back();
+    }
+}
+
+// Optimise la tournée et retourne le résultat sous forme de Tour
+Tour LinKernighan::optimize(const Tour& tour) {
+    return optimize(tour, tour.getNodes());
+}
+
+// Optimise la tournée à partir des seuls nœuds seeds
+Tour LinKernighan::optimize(const Tour& tour, const std::vector<int>& seeds) {
+    if (tour.size() < 8) {
+        return tour;
+    }
+    TwoLevelList list(tour.getNodes());
+    list_ = &list;
+
+    for (int node : seeds) {
+        activate(node);
+    }
+    while (!queue_.empty() && !CancellationToken::isCancelled(cancellation_)) {
+        int t1 = queue_.front();
+        queue_.pop_front();
+        active_[t1] = 0;
+
+        while (improve(t1) > 0) {
+            TSP_STATS_ADD(MovesApplied, 1);
+            // Réactiver les extrémités des arêtes modifiées
+            for (const Flip& flip : flips_) {
+                activate(flip.a);
+                activate(flip.b);
+                activate(flip.c);
+                activate(flip.d);
+            }
+            flips_.clear();
+        }
+    }
+    // Après une annulation, la file est vidée pour un éventuel appel suivant
+    for (int node : queue_) {
+        active_[node] = 0;
+    }
+    queue_.clear();
+
+    list_ = nullptr;
+    return Tour(list.toVector(tour.getNodes().front()), graph_);
+}
+
+// Cherche une suite améliorante partant de t1
+int LinKernighan::improve(int t1) {
+    for (int side = 0; side < 2; ++side) {
+        int t2 = side == 0 ? list_->next(t1) : list_->prev(t1);
+        int gain = step(1, t1, t2, graph_.distance(t1, t2));
+        if (gain > 0) {
+            return gain;
+        }
+    }
+    return 0;
+}
+
+// Étape de profondeur depth de la suite de mouvements
+int LinKernighan::step(int depth, int t1, int t2, int gain) {
+    // Tampon propre à la profondeur : les étapes plus profondes ne l'écrasent pas
+    std::vector<Alternative>& alternatives = alternatives_[depth - 1];
+    alternatives.clear();
+
+    // t4 est le voisin de t3 situé du même côté que t1 par rapport à t2
+    bool forward = list_->next(t2) == t1;
+
+    const int* first;
+    const int* last;
+    bool sorted;
+    const CandidateSet& candidates = graph_.getCandidates();
+    if (!candidates.empty()) {
+        first = candidates.begin(t2);
+        last = candidates.end(t2);
+        sorted = candidates.isSortedByDistance();
+    } else {
+        first = allNodes_.data();
+        last = allNodes_.data() + allNodes_.size();
+        sorted = false;
+    }
+
+    for (const int* it = first; it != last; ++it) {
+        int t3 = *it;
+        int g1 = gain - graph_.distance(t2, t3);
+        if (g1 <= 0) {
+            if (sorted) {
+                break;
+            }
+            continue;
+        }
+        int t4 = forward ? list_->next(t3) : list_->prev(t3);
+        if (t3 == t1 || t3 == t2 || t4 == t2) {
+            continue;
+        }
+        // Ne pas retirer une arête ajoutée plus tôt dans la suite
+        bool tabu = false;
+        for (const Flip& flip : flips_) {
+            if ((flip.a == t3 && flip.c == t4) || (flip.a == t4 && flip.c == t3)) {
+                tabu = true;
+                break;
+            }
+        }
+        if (!tabu) {
+            alternatives.push_back(Alternative{t3, t4, g1 + graph_.distance(t3, t4)});
+        }
+    }
+
+    std::sort(alternatives.begin(), alternatives.end(),
+              [](const Alternative& x, const Alternative& y) { return x.value > y.value; });
+    int breadth = std::min(static_cast<int>(alternatives.size()), kBreadth[depth - 1]);
+
+    for (int i = 0; i < breadth; ++i) {
+        const Alternative& alt = alternatives[i];
+        size_t mark = flips_.size();
+
+        // Retire (t1, t2) et (t3, t4), ajoute (t2, t3) et l'arête de fermeture (t1, t4)
+        applyFlip(t2, t1, alt.t3, alt.t4);
+        int closed = alt.value - graph_.distance(alt.t4, t1);
+        TSP_STATS_ADD(MovesEvaluated, 1);
+        if (closed > 0) {
+            return closed;
+        }
+        if (depth < kMaxDepth) {
+            int deeper = step(depth + 1, t1, alt.t4, alt.value);
+            if (deeper > 0) {
+                return deeper;
+            }
+        }
+        undoFlips(mark);
+    }
+    return 0;
+}
@@ -0,0 +1,73 @@
+#ifndef LIN_KERNIGHAN_H
+#define LIN_KERNIGHAN_H
+
+#include <vector>
+#include <deque>
+
+#include "Graph.h"
+#include "Tour.h"
+#include "TwoLevelList.h"
+#include "CancellationToken.h"
+
+// Recherche à profondeur variable de type Lin-Kernighan.
+// Chaque mouvement est une suite d'au plus kMaxDepth mouvements 2-opt séquentiels
+// (t1 reste fixe, chaque étape choisit t3 parmi les candidats du dernier t2),
+// appliquée sur une liste doublement chaînée à deux niveaux pour que chaque
+// inversion coûte O(sqrt(N)). Dès que la tournée raccourcit, la suite est conservée ;
+// sinon les inversions sont annulées.
+class LinKernighan {
+public:
+    // Constructeur : prend une référence constante au graphe
+    explicit LinKernighan(const Graph& graph);
+
+    // Optimise la tournée et retourne le résultat sous forme de Tour
+    Tour optimize(const Tour& tour);
+
+    // Variante dont seuls les nœuds seeds sont actifs au départ (réoptimisation locale)
+    Tour optimize(const Tour& tour, const std::vector<int>& seeds);
+
+    // Jeton d'annulation consulté avant chaque nœud actif (nullptr : aucun)
+    void setCancellation(const CancellationToken* token) { cancellation_ = token; }
+
+private:
+    // Inversion appliquée pendant l'exploration, à annuler en cas d'échec
+    struct Flip {
+        int a, b, c, d;
+    };
+
+    // Candidat t3 d'une étape, son voisin t4 et le gain cumulé après retrait de (t3, t4)
+    struct Alternative {
+        int t3, t4, value;
+    };
+
+    const Graph& graph_;
+    TwoLevelList* list_ = nullptr; // Tournée en cours d'optimisation
+    std::vector<Flip> flips_;      // Inversions de la suite en cours
+    std::vector<char> active_;     // Bits don't-look (vrai si le nœud est dans la file)
+    std::deque<int> queue_;
+    std::vector<int> allNodes_;    // Voisins examinés si aucune liste de candidats n'existe
+    // Alternatives de chaque profondeur, réservées une fois : aucune allocation par étape
+    std::vector<std::vector<Alternative>> alternatives_;
+    const CancellationToken* cancellation_ = nullptr;
+
+    // Active un nœud
+    void activate(int node);
+
+    // Cherche une suite améliorante partant de t1 ; retourne le gain obtenu (0 si aucun)
+    int improve(int t1);
+
+    // Étape de profondeur depth : le chemin ouvert va de t1 à t2, avec un gain
+    // cumulé gain (longueur des arêtes retirées moins celle des arêtes ajoutées)
+    int step(int depth, int t1, int t2, int gain);
+
+    // Applique une inversion et l'enregistre
+    void applyFlip(int a, int b, int c, int d);
+
+    // Annule les inversions jusqu'à n'en garder que count
+    void undoFlips(size_t count);
+
+    LinKernighan(const LinKernighan&) = delete;
+    LinKernighan& operator=(const LinKernighan&) = delete;
+};
+
+#endif
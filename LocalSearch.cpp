@@ -0,0 +1,377 @@
+#include "LocalSearch.h"
+#include <algorithm> // Pour std::fill
+#include "Stats.h"
+#include "DistancePolicy.h"
+
+// Constructeur
+LocalSearch::LocalSearch(const Graph& graph)
+    : graph_(graph), active_(graph.getDimension(), 0) {
+    if (graph_.getCandidates().empty()) {
+        allNodes_.resize(graph_.getDimension());
+        for (int i = 0; i < graph_.getDimension(); ++i) {
+            allNodes_[i] = i;
+        }
+    }
+}
+
+// Active tous les nœuds de la tournée
+void LocalSearch::activateAll(const Tour& tour) {
+    for (int node : tour.getNodes()) {
+        activate(node);
+    }
+}
+
+// Active un nœud
+void LocalSearch::activate(int node) {
+    if (!active_[node]) {
+        active_[node] = 1;
+        queue_.push_back(node);
+    }
+}
+
+// Ouvre le journal des mouvements
+void LocalSearch::beginJournal() {
+    journaling_ = true;
+    journal_.clear();
+}
+
+// Ferme le journal en conservant les mouvements appliqués
+void LocalSearch::commitJournal() {
+    journaling_ = false;
+    journal_.clear();
+}
+
+// Annule les mouvements du journal, du plus récent au plus ancien.
+// Après twoOptMove(a, b, c, d), c suit a et d suit b : twoOptMove(a, c, b, d)
+// rétablit les arêtes (a, b) et (c, d).
+void LocalSearch::undoJournal(Tour& tour) {
+    for (auto it = journal_.rbegin(); it != journal_.rend(); ++it) {
+        tour.twoOptMove(it->a, it->c, it->b, it->d, -it->delta);
+    }
+    journaling_ = false;
+    journal_.clear();
+}
+
+// Applique un mouvement 2-opt (et l'enregistre si le journal est ouvert)
+void LocalSearch::applyTwoOpt(Tour& tour, int a, int b, int c, int d, long delta) {
+    tour.twoOptMove(a, b, c, d, delta);
+    if (journaling_) {
+        journal_.push_back(Move{a, b, c, d, delta});
+    }
+}
+
+// Retire le prochain nœud actif de la file
+int LocalSearch::popActive() {
+    if (queue_.empty()) {
+        return -1;
+    }
+    int node = queue_.front();
+    queue_.pop_front();
+    active_[node] = 0;
+    return node;
+}
+
+// Plage des voisins à examiner pour le nœud a
+void LocalSearch::neighbors(int a, const int*& first, const int*& last, bool& sorted) const {
+    const CandidateSet& candidates = graph_.getCandidates();
+    if (!candidates.empty()) {
+        first = candidates.begin(a);
+        last = candidates.end(a);
+        sorted = candidates.isSortedByDistance();
+    } else {
+        first = allNodes_.data();
+        last = allNodes_.data() + allNodes_.size();
+        sorted = false;
+    }
+}
+
+// Applique les opérateurs demandés jusqu'à épuisement de la file des nœuds actifs
+// La représentation des distances est choisie une fois ici : la boucle et les
+// opérateurs sont compilés pour chaque politique de distance.
+int LocalSearch::optimize(Tour& tour, int operators) {
+    if (tour.size() < 8) {
+        // Trop peu de nœuds pour que les segments et arêtes examinés soient disjoints
+        queue_.clear();
+        std::fill(active_.begin(), active_.end(), 0);
+        return 0;
+    }
+    int moves = 0;
+    withDistancePolicy(graph_, [&](const auto& dist) { moves = optimizeWith(tour, operators, dist); });
+    return moves;
+}
+
+// Boucle de optimize() pour une politique de distance
+template <typename Distance>
+int LocalSearch::optimizeWith(Tour& tour, int operators, const Distance& dist) {
+    int moves = 0;
+    while (!CancellationToken::isCancelled(cancellation_)) {
+        int a = popActive();
+        if (a == -1) {
+            break;
+        }
+        // Un nœud amélioré est réexaminé tant qu'il trouve des mouvements ;
+        // les opérateurs plus coûteux ne sont essayés qu'en dernier recours
+        for (;;) {
+            if ((operators & TwoOpt) && improveTwoOpt(tour, a, dist)) {
+                ++moves;
+            } else if ((operators & OrOpt) && improveOrOpt(tour, a, dist)) {
+                ++moves;
+            } else if ((operators & ThreeOpt) && improveThreeOpt(tour, a, dist)) {
+                ++moves;
+            } else {
+                break;
+            }
+        }
+    }
+    TSP_STATS_ADD(MovesApplied, moves);
+    return moves;
+}
+
+// Cherche et applique le meilleur mouvement 2-opt impliquant une arête de a
+template <typename Distance>
+bool LocalSearch::improveTwoOpt(Tour& tour, int a, const Distance& dist) {
+    const int* first;
+    const int* last;
+    bool sorted;
+    neighbors(a, first, last, sorted);
+
+    int best_delta = 0;
+    int best_b = -1, best_c = -1, best_d = -1;
+
+    // Deux sens : arête (a, succ(a)) puis arête (pred(a), a)
+    for (int direction = 0; direction < 2; ++direction) {
+        int b = direction == 0 ? tour.next(a) : tour.prev(a);
+        int d_ab = dist(a, b);
+
+        for (const int* it = first; it != last; ++it) {
+            int c = *it;
+            if (c == a) {
+                continue;
+            }
+            int d_ac = dist(a, c);
+            // Gain partiel : la nouvelle arête (a, c) doit être plus courte que (a, b)
+            if (d_ac >= d_ab) {
+                if (sorted) {
+                    break; // Les candidats suivants sont encore plus éloignés
+                }
+                continue;
+            }
+            int d = direction == 0 ? tour.next(c) : tour.prev(c);
+            if (c == b || d == a) {
+                continue;
+            }
+            int delta = d_ac + dist(b, d) - d_ab - dist(c, d);
+            TSP_STATS_ADD(MovesEvaluated, 1);
+            if (delta < best_delta) {
+                best_delta = delta;
+                best_b = b;
+                best_c = c;
+                best_d = d;
+            }
+        }
+    }
+
+    if (best_delta >= 0) {
+        return false;
+    }
+
+    // Appliquer le mouvement sur place et réactiver ses extrémités
+    applyTwoOpt(tour, a, best_b, best_c, best_d, best_delta);
+    activate(best_b);
+    activate(best_c);
+    activate(best_d);
+    return true;
+}
+
+
+// Cherche et applique le meilleur déplacement d'un segment commençant en s1
+template <typename Distance>
+bool LocalSearch::improveOrOpt(Tour& tour, int s1, const Distance& dist) {
+    int best_delta = 0;
+    int best_s2 = -1, best_x = -1, best_y = -1;
+    bool best_reversed = false;
+
+    int p = tour.prev(s1);
+    int s2 = s1;
+    for (int length = 1; length <= 3; ++length) {
+        if (length > 1) {
+            s2 = tour.next(s2);
+        }
+        int n = tour.next(s2);
+        if (n == p) {
+            break;
+        }
+
+        // Gain du retrait du segment : (p, s1) et (s2, n) remplacées par (p, n)
+        int removal_gain = dist(p, s1) + dist(s2, n) - dist(p, n);
+        if (removal_gain <= 0) {
+            continue;
+        }
+
+        // Le segment s'insère entre x et y = succ(x), en étant relié à un candidat
+        // de s1 ou de s2 : chaque extrémité essaie les deux arêtes de son candidat
+        for (int end = 0; end < 2; ++end) {
+            int endpoint = end == 0 ? s1 : s2;
+            int other = end == 0 ? s2 : s1;
+            const int* first;
+            const int* last;
+            bool sorted;
+            neighbors(endpoint, first, last, sorted);
+
+            for (const int* it = first; it != last; ++it) {
+                int c = *it;
+                int d_ec = dist(endpoint, c);
+                if (d_ec >= removal_gain) {
+                    if (sorted) {
+                        break;
+                    }
+                    continue;
+                }
+                for (int side = 0; side < 2; ++side) {
+                    int x = side == 0 ? c : tour.prev(c);
+                    int y = side == 0 ? tour.next(c) : c;
+                    // L'arête (x, y) doit être hors du segment
+                    bool inside = false;
+                    for (int v = s1;; v = tour.next(v)) {
+                        if (v == x || v == y) {
+                            inside = true;
+                            break;
+                        }
+                        if (v == s2) {
+                            break;
+                        }
+                    }
+                    if (inside) {
+                        continue;
+                    }
+                    // c = x relié à s1 : x s1..s2 y ; c = y relié à s1 : x s2..s1 y (et symétriquement pour s2)
+                    bool reversed = (end == 0) == (side == 1);
+                    int delta = d_ec + dist(other, side == 0 ? y : x)
+                                - dist(x, y) - removal_gain;
+                    TSP_STATS_ADD(MovesEvaluated, 1);
+                    if (delta < best_delta) {
+                        best_delta = delta;
+                        best_s2 = s2;
+                        best_x = x;
+                        best_y = y;
+                        best_reversed = reversed;
+                    }
+                }
+            }
+        }
+    }
+
+    if (best_delta >= 0) {
+        return false;
+    }
+
+    int n = tour.next(best_s2);
+    moveSegment(tour, p, s1, best_s2, n, best_x, best_y, best_reversed);
+    activate(p);
+    activate(n);
+    activate(best_s2);
+    activate(best_x);
+    activate(best_y);
+    return true;
+}
+
+// Déplace le segment s1..s2 entre x et y par une suite de mouvements 2-opt
+// p s1..s2 n X x y  ->  p x X' n s2..s1 y  ->  p n X x s2..s1 y  [->  p n X x s1..s2 y]
+void LocalSearch::moveSegment(Tour& tour, int p, int s1, int s2, int n, int x, int y, bool reversed) {
+    applyTwoOpt(tour, p, s1, x, y, graph_.distance(p, x) + graph_.distance(s1, y)
+                                   - graph_.distance(p, s1) - graph_.distance(x, y));
+    applyTwoOpt(tour, p, x, n, s2, graph_.distance(p, n) + graph_.distance(x, s2)
+                                   - graph_.distance(p, x) - graph_.distance(n, s2));
+    if (!reversed && s1 != s2) {
+        applyTwoOpt(tour, x, s2, s1, y, graph_.distance(x, s1) + graph_.distance(s2, y)
+                                        - graph_.distance(x, s2) - graph_.distance(s1, y));
+    }
+}
+
+// Cherche et applique un échange de segments "or3" partant de l'arête de t1
+// a b..c d..e f  ->  a d..e b..c f : arêtes (a, b), (c, d), (e, f) remplacées
+// par (b, e), (f, c) et (d, a), cherchées séquentiellement parmi les candidats
+template <typename Distance>
+bool LocalSearch::improveThreeOpt(Tour& tour, int t1, const Distance& dist) {
+    int n = tour.size();
+    for (int direction = 0; direction < 2; ++direction) {
+        // Dans le sens de parcours choisi, succ() et l'écart de positions
+        auto succ = [&tour, direction](int v) { return direction == 0 ? tour.next(v) : tour.prev(v); };
+        auto offset = [&tour, direction, n](int from, int to) {
+            int diff = direction == 0 ? tour.getPosition(to) - tour.getPosition(from)
+                                      : tour.getPosition(from) - tour.getPosition(to);
+            return diff < 0 ? diff + n : diff;
+        };
+
+        int a = t1;
+        int b = succ(a);
+        int d_ab = dist(a, b);
+
+        const int* first_e;
+        const int* last_e;
+        bool sorted_e;
+        neighbors(b, first_e, last_e, sorted_e);
+        for (const int* it_e = first_e; it_e != last_e; ++it_e) {
+            int e = *it_e;
+            int g1 = d_ab - dist(b, e);
+            if (g1 <= 0) {
+                if (sorted_e) {
+                    break;
+                }
+                continue;
+            }
+            int f = succ(e);
+            // e doit suivre b d'au moins un nœud (segment d..e non vide après b..c)
+            if (e == a || e == b || f == b || offset(b, e) < 1) {
+                continue;
+            }
+            int g1_open = g1 + dist(e, f);
+
+            const int* first_c;
+            const int* last_c;
+            bool sorted_c;
+            neighbors(f, first_c, last_c, sorted_c);
+            for (const int* it_c = first_c; it_c != last_c; ++it_c) {
+                int c = *it_c;
+                int g2 = g1_open - dist(f, c);
+                if (g2 <= 0) {
+                    if (sorted_c) {
+                        break;
+                    }
+                    continue;
+                }
+                // c doit se trouver sur b..e, strictement avant e
+                if (c == f || offset(b, c) >= offset(b, e)) {
+                    continue;
+                }
+                int d = succ(c);
+                int gain = g2 + dist(c, d) - dist(d, a);
+                TSP_STATS_ADD(MovesEvaluated, 1);
+                if (gain <= 0) {
+                    continue;
+                }
+
+                segmentExchange(tour, a, b, c, d, e, f);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// Échange les segments consécutifs b..c et d..e
+// a b..c d..e f -> a e..d c..b f -> a d..e c..b f -> a d..e b..c f
+void LocalSearch::segmentExchange(Tour& tour, int a, int b, int c, int d, int e, int f) {
+    applyTwoOpt(tour, a, b, e, f, graph_.distance(a, e) + graph_.distance(b, f)
+                                  - graph_.distance(a, b) - graph_.distance(e, f));
+    applyTwoOpt(tour, a, e, d, c, graph_.distance(a, d) + graph_.distance(e, c)
+                                  - graph_.distance(a, e) - graph_.distance(d, c));
+    applyTwoOpt(tour, e, c, b, f, graph_.distance(e, b) + graph_.distance(c, f)
+                                  - graph_.distance(e, c) - graph_.distance(b, f));
+    activate(a);
+    activate(b);
+    activate(c);
+    activate(d);
+    activate(e);
+    activate(f);
+}
@@ -0,0 +1,106 @@
+#ifndef LOCAL_SEARCH_H
+#define LOCAL_SEARCH_H
+
+#include <vector>
+#include <deque>
+
+#include "Graph.h"
+#include "Tour.h"
+#include "CancellationToken.h"
+
+// Moteur de recherche locale sur place.
+// Les mouvements sont appliqués directement sur le Tour (sans copie) et évalués
+// en O(1) à partir de la variation de longueur. Seuls les candidats de chaque
+// nœud sont examinés, et des bits "don't-look" (file de nœuds actifs) évitent de
+// réexaminer les nœuds dont le voisinage n'a pas changé.
+class LocalSearch {
+public:
+    // Constructeur : prend une référence constante au graphe
+    explicit LocalSearch(const Graph& graph);
+
+    // Active tous les nœuds de la tournée
+    void activateAll(const Tour& tour);
+
+    // Active un nœud (remet son bit don't-look à zéro)
+    void activate(int node);
+
+    // Jeton d'annulation consulté avant chaque nœud actif (nullptr : aucun). Une fois
+    // annulée, optimize() rend la main en laissant la file en l'état.
+    void setCancellation(const CancellationToken* token) { cancellation_ = token; }
+
+    // Opérateurs de voisinage, combinables par OU binaire
+    enum Operator {
+        TwoOpt = 1,   // Échange de deux arêtes
+        OrOpt = 2,    // Déplacement d'un segment de 1 à 3 nœuds, inversé ou non
+        ThreeOpt = 4, // 3-opt restreint "or3" : échange de deux segments consécutifs
+        AllOperators = TwoOpt | OrOpt | ThreeOpt
+    };
+
+    // Applique les opérateurs demandés jusqu'à épuisement de la file des nœuds actifs
+    // Retourne le nombre de mouvements améliorants appliqués.
+    int optimize(Tour& tour, int operators);
+
+    // 2-opt seul jusqu'à épuisement de la file des nœuds actifs
+    int twoOpt(Tour& tour) { return optimize(tour, TwoOpt); }
+
+    // Échange les segments consécutifs b..c et d..e, où b suit a, d suit c et f suit e
+    // dans un même sens de parcours : a b..c d..e f -> a d..e b..c f. C'est un double
+    // pont dont le coût ne dépend que de la longueur des segments ; ses extrémités sont activées.
+    void segmentExchange(Tour& tour, int a, int b, int c, int d, int e, int f);
+
+    // Journal des mouvements : tant qu'il est ouvert, chaque mouvement appliqué est
+    // enregistré et undoJournal() peut ramener la tournée à son état d'ouverture
+    void beginJournal();
+    void commitJournal();
+    void undoJournal(Tour& tour);
+
+private:
+    const Graph& graph_;
+    std::vector<char> active_; // Vrai si le nœud est dans la file (bit don't-look à zéro)
+    std::deque<int> queue_;    // File des nœuds actifs
+    std::vector<int> allNodes_; // Voisins examinés si aucune liste de candidats n'existe
+    const CancellationToken* cancellation_ = nullptr;
+
+    // Mouvement 2-opt enregistré dans le journal
+    struct Move {
+        int a, b, c, d;
+        long delta;
+    };
+    bool journaling_ = false;
+    std::vector<Move> journal_;
+
+    // Applique un mouvement 2-opt (et l'enregistre si le journal est ouvert)
+    void applyTwoOpt(Tour& tour, int a, int b, int c, int d, long delta);
+
+    // Retire le prochain nœud actif de la file (-1 si elle est vide)
+    int popActive();
+
+    // Plage des voisins à examiner pour le nœud a ; sorted indique si elle est
+    // triée par distance croissante (ce qui permet d'arrêter le parcours plus tôt)
+    void neighbors(int a, const int*& first, const int*& last, bool& sorted) const;
+
+    // Boucle de optimize(), spécialisée pour une politique de distance (DistancePolicy.h)
+    template <typename Distance>
+    int optimizeWith(Tour& tour, int operators, const Distance& dist);
+
+    // Cherche et applique le meilleur mouvement 2-opt impliquant une arête de a
+    template <typename Distance>
+    bool improveTwoOpt(Tour& tour, int a, const Distance& dist);
+
+    // Cherche et applique le meilleur déplacement d'un segment commençant en s1
+    template <typename Distance>
+    bool improveOrOpt(Tour& tour, int s1, const Distance& dist);
+
+    // Cherche et applique un échange de segments "or3" partant de l'arête de t1
+    template <typename Distance>
+    bool improveThreeOpt(Tour& tour, int t1, const Distance& dist);
+
+    // Déplace le segment s1..s2 (entre p et n) entre x et y = succ(x),
+    // par une suite de mouvements 2-opt ; reversed insère s2..s1
+    void moveSegment(Tour& tour, int p, int s1, int s2, int n, int x, int y, bool reversed);
+
+    LocalSearch(const LocalSearch&) = delete;
+    LocalSearch& operator=(const LocalSearch&) = delete;
+};
+
+#endif
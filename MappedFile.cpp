@@ -0,0 +1,58 @@
+#include "MappedFile.h"
+#include <fstream>
+#include <iterator> // Pour std::istreambuf_iterator
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Destructeur
+MappedFile::~MappedFile() {
+    close();
+}
+
+// Ouvre et projette le fichier ; faux en cas d'échec
+bool MappedFile::open(const std::string& filename) {
+    close();
+
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    if (::fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0) {
+        void* address = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address != MAP_FAILED) {
+            // Lecture séquentielle : le noyau peut lire en avance
+            ::madvise(address, static_cast<std::size_t>(info.st_size), MADV_SEQUENTIAL);
+            mapping_ = address;
+            data_ = static_cast<const char*>(address);
+            size_ = static_cast<std::size_t>(info.st_size);
+            ::close(fd);
+            return true;
+        }
+    }
+    ::close(fd);
+
+    // Repli : lecture complète dans un tampon
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    buffer_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+    return true;
+}
+
+// Libère la projection
+void MappedFile::close() {
+    if (mapping_ != nullptr) {
+        ::munmap(mapping_, size_);
+        mapping_ = nullptr;
+    }
+    buffer_.clear();
+    data_ = nullptr;
+    size_ = 0;
+}
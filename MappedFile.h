@@ -0,0 +1,35 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+
+// Fichier en lecture seule projeté en mémoire (mmap).
+// Si la projection échoue (fichier spécial, système sans mmap...), le contenu
+// est lu dans un tampon : data() et size() restent valides dans les deux cas.
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    // Ouvre et projette le fichier ; faux en cas d'échec
+    bool open(const std::string& filename);
+
+    // Libère la projection
+    void close();
+
+    const char* data() const { return data_; }
+    std::size_t size() const { return size_; }
+
+private:
+    const char* data_ = nullptr;
+    std::size_t size_ = 0;
+    void* mapping_ = nullptr;   // Adresse retournée par mmap (nullptr si tampon)
+    std::vector<char> buffer_;  // Contenu lu lorsque mmap n'est pas utilisable
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+};
+
+#endif
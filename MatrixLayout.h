@@ -0,0 +1,67 @@
+#ifndef MATRIX_LAYOUT_H
+#define MATRIX_LAYOUT_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Disposition mémoire d'une matrice de distances stockée dans un tampon plat
+enum class MatrixLayout {
+    Full,          // Matrice complète N x N, ligne par ligne (row-major)
+    UpperTriangle  // Triangle supérieur (diagonale comprise), pour les matrices symétriques
+};
+
+// Type des poids stockés dans la matrice : le plus étroit qui contient tous les poids
+// réduit d'autant la mémoire et la bande passante consommées par les recherches locales
+enum class WeightType {
+    Int32,  // int
+    UInt16, // std::uint16_t : poids de 0 à 65535
+    UInt8   // std::uint8_t : poids de 0 à 255
+};
+
+// Taille en octets d'un poids
+inline std::size_t weightSize(WeightType type) {
+    return type == WeightType::Int32 ? sizeof(std::int32_t) : (type == WeightType::UInt16 ? sizeof(std::uint16_t) : sizeof(std::uint8_t));
+}
+
+// Type le plus étroit pouvant stocker des poids compris entre minWeight et maxWeight
+inline WeightType narrowestWeightType(int minWeight, int maxWeight) {
+    if (minWeight < 0 || maxWeight > 65535) {
+        return WeightType::Int32;
+    }
+    return maxWeight > 255 ? WeightType::UInt16 : WeightType::UInt8;
+}
+
+// Nombre d'éléments nécessaires pour stocker une matrice de dimension n
+inline std::size_t matrixStorageSize(int n, MatrixLayout layout) {
+    std::size_t dim = static_cast<std::size_t>(n);
+    return layout == MatrixLayout::Full ? dim * dim : dim * (dim + 1) / 2;
+}
+
+// Budget mémoire de la matrice en mode de distance automatique. Les poids sont comptés
+// sur 32 bits : leur largeur réduite n'est connue qu'une fois la matrice calculée.
+static const std::size_t kAutoMatrixBudgetBytes = 64 * 1024 * 1024;
+
+// Vrai si le mode automatique doit calculer les distances à la demande : la matrice
+// dépasserait le budget (au-delà d'environ 4100 nœuds en matrice complète, 5800 en
+// triangle supérieur). Avec les listes de candidats, les recherches ne lisent plus
+// qu'une fraction des N² distances : les calculer coûte moins que remplir la matrice.
+inline bool exceedsAutoMatrixBudget(int n, MatrixLayout layout) {
+    return matrixStorageSize(n, layout) * sizeof(std::int32_t) > kAutoMatrixBudgetBytes;
+}
+
+// Indice de l'élément (i, j) avec i <= j dans le triangle supérieur
+// Ligne i : elle commence après les i premières lignes de tailles n, n-1, ..., n-i+1
+inline std::size_t upperTriangleIndex(int i, int j, int n) {
+    std::size_t row = static_cast<std::size_t>(i);
+    return row * (2 * static_cast<std::size_t>(n) - row - 1) / 2 + static_cast<std::size_t>(j);
+}
+
+// Indice de l'élément (i, j) quelle que soit la disposition
+inline std::size_t matrixIndex(int i, int j, int n, MatrixLayout layout) {
+    if (layout == MatrixLayout::Full) {
+        return static_cast<std::size_t>(i) * static_cast<std::size_t>(n) + static_cast<std::size_t>(j);
+    }
+    return i <= j ? upperTriangleIndex(i, j, n) : upperTriangleIndex(j, i, n);
+}
+
+#endif
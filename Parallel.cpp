@@ -0,0 +1,43 @@
+#include "Parallel.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <algorithm> // Pour std::min, std::max
+
+#include "Stats.h"
+
+// Nombre de threads matériels disponibles
+int hardwareThreads() {
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Exécute body(index, worker) pour index = 0..count-1
+void parallelFor(int count, int threads, const std::function<void(int index, int worker)>& body) {
+    threads = std::min(threads, count);
+    if (threads <= 1) {
+        for (int index = 0; index < count; ++index) {
+            body(index, 0);
+        }
+        return;
+    }
+
+    std::atomic<int> next(0);
+    auto work = [&next, &body, count](int worker) {
+        for (int index = next.fetch_add(1); index < count; index = next.fetch_add(1)) {
+            body(index, worker);
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    for (int worker = 1; worker < threads; ++worker) {
+        pool.emplace_back([&work, worker]() {
+            work(worker);
+            Stats::flushThread(); // Les compteurs du thread disparaissent avec lui
+        });
+    }
+    work(0); // Le thread appelant travaille aussi
+    for (std::thread& thread : pool) {
+        thread.join();
+    }
+}
@@ -0,0 +1,15 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <functional>
+
+// Nombre de threads matériels disponibles (au moins 1)
+int hardwareThreads();
+
+// Exécute body(index, worker) pour index = 0..count-1 sur threads threads.
+// Les indices sont distribués dynamiquement (compteur atomique) ; worker identifie
+// le thread (0..threads-1) pour que chacun tienne son propre état sans verrou.
+// Avec threads <= 1, tout s'exécute dans le thread appelant.
+void parallelFor(int count, int threads, const std::function<void(int index, int worker)>& body);
+
+#endif
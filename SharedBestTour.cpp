@@ -0,0 +1,35 @@
+#include "SharedBestTour.h"
+
+// Constructeur
+SharedBestTour::SharedBestTour(const Tour& tour) : length_(tour.getTotalDistance()), tour_(tour) {
+}
+
+// Propose une tournée
+bool SharedBestTour::offer(const Tour& tour) {
+    if (tour.getTotalDistance() >= length()) {
+        return false; // Cas courant : aucune synchronisation
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (tour.getTotalDistance() >= tour_.getTotalDistance()) {
+        return false; // Une autre île a publié mieux entre-temps
+    }
+    tour_ = tour;
+    length_.store(tour.getTotalDistance(), std::memory_order_release);
+    return true;
+}
+
+// Copie la meilleure tournée si elle est plus courte que out
+bool SharedBestTour::copyIfBetter(Tour& out) const {
+    if (length() >= out.getTotalDistance()) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    out = tour_;
+    return true;
+}
+
+// Copie de la meilleure tournée
+Tour SharedBestTour::get() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return tour_;
+}
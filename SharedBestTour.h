@@ -0,0 +1,40 @@
+#ifndef SHARED_BEST_TOUR_H
+#define SHARED_BEST_TOUR_H
+
+#include <atomic>
+#include <mutex>
+
+#include "Tour.h"
+
+// Meilleure tournée partagée entre les îles de la recherche parallèle.
+// La longueur est lue sans verrou (atomique) : une île ne prend le verrou que
+// pour publier une tournée plus courte ou pour copier la meilleure, ce qui reste
+// rare par rapport au nombre de perturbations.
+class SharedBestTour {
+public:
+    // Constructeur : tournée initiale
+    explicit SharedBestTour(const Tour& tour);
+
+    // Longueur de la meilleure tournée (sans verrou)
+    long length() const { return length_.load(std::memory_order_acquire); }
+
+    // Propose une tournée ; elle remplace la meilleure si elle est strictement plus
+    // courte. Retourne vrai si elle a été retenue.
+    bool offer(const Tour& tour);
+
+    // Copie la meilleure tournée dans out si elle est plus courte que out
+    bool copyIfBetter(Tour& out) const;
+
+    // Copie de la meilleure tournée
+    Tour get() const;
+
+private:
+    mutable std::mutex mutex_;
+    std::atomic<long> length_;
+    Tour tour_;
+
+    SharedBestTour(const SharedBestTour&) = delete;
+    SharedBestTour& operator=(const SharedBestTour&) = delete;
+};
+
+#endif
@@ -0,0 +1,136 @@
+#include "SpatialGrid.h"
+#include <algorithm> // Pour std::min, std::max
+#include <cmath>     // Pour std::sqrt, std::ceil
+#include <limits>    // Pour std::numeric_limits
+
+// Constructeur
+SpatialGrid::SpatialGrid(const std::vector<Point>& points)
+    : points_(points), remaining_(static_cast<int>(points.size())) {
+    int n = remaining_;
+    if (n == 0) {
+        cellStart_.assign(1, 0);
+        cellCount_.assign(1, 0);
+        return;
+    }
+
+    double max_x = points_[0].x, max_y = points_[0].y;
+    minX_ = points_[0].x;
+    minY_ = points_[0].y;
+    for (const Point& p : points_) {
+        minX_ = std::min(minX_, p.x);
+        minY_ = std::min(minY_, p.y);
+        max_x = std::max(max_x, p.x);
+        max_y = std::max(max_y, p.y);
+    }
+
+    // Environ deux nœuds par cellule
+    double width = std::max(max_x - minX_, 1e-9);
+    double height = std::max(max_y - minY_, 1e-9);
+    double cells = std::max(1.0, n / 2.0);
+    cellSize_ = std::max(std::sqrt(width * height / cells), std::max(width, height) / cells);
+    columns_ = std::max(1, static_cast<int>(std::ceil(width / cellSize_)));
+    rows_ = std::max(1, static_cast<int>(std::ceil(height / cellSize_)));
+
+    // Tri par cellule (comptage), en O(N)
+    int cell_total = columns_ * rows_;
+    cellStart_.assign(cell_total + 1, 0);
+    cellCount_.assign(cell_total, 0);
+    cellOf_.resize(n);
+    for (int i = 0; i < n; ++i) {
+        cellOf_[i] = rowOf(points_[i].y) * columns_ + columnOf(points_[i].x);
+        ++cellCount_[cellOf_[i]];
+    }
+    for (int c = 0; c < cell_total; ++c) {
+        cellStart_[c + 1] = cellStart_[c] + cellCount_[c];
+    }
+    items_.resize(n);
+    slotOf_.resize(n);
+    std::vector<int> fill(cellStart_.begin(), cellStart_.end() - 1);
+    for (int i = 0; i < n; ++i) {
+        int slot = fill[cellOf_[i]]++;
+        items_[slot] = i;
+        slotOf_[i] = slot;
+    }
+}
+
+// Coordonnées de cellule d'un point (bornées à la grille)
+int SpatialGrid::columnOf(double x) const {
+    int column = static_cast<int>((x - minX_) / cellSize_);
+    return std::min(std::max(column, 0), columns_ - 1);
+}
+
+int SpatialGrid::rowOf(double y) const {
+    int row = static_cast<int>((y - minY_) / cellSize_);
+    return std::min(std::max(row, 0), rows_ - 1);
+}
+
+// Retire un nœud de la grille
+void SpatialGrid::remove(int node) {
+    int cell = cellOf_[node];
+    int slot = slotOf_[node];
+    int last = cellStart_[cell] + cellCount_[cell] - 1;
+    if (slot < 0 || slot > last) {
+        return; // Déjà retiré
+    }
+    // Échanger avec le dernier nœud présent de la cellule
+    int moved = items_[last];
+    items_[slot] = moved;
+    slotOf_[moved] = slot;
+    items_[last] = node;
+    slotOf_[node] = -1;
+    --cellCount_[cell];
+    --remaining_;
+}
+
+// Plus proche nœud encore présent
+int SpatialGrid::nearest(const Point& p) const {
+    if (remaining_ == 0) {
+        return -1;
+    }
+    int cx = columnOf(p.x);
+    int cy = rowOf(p.y);
+    int best = -1;
+    double best_distance2 = std::numeric_limits<double>::max();
+    int max_ring = std::max(columns_, rows_);
+
+    // Examine les nœuds présents d'une cellule
+    auto scan_cell = [&](int x, int y) {
+        int cell = y * columns_ + x;
+        for (int k = cellStart_[cell]; k < cellStart_[cell] + cellCount_[cell]; ++k) {
+            int node = items_[k];
+            double dx = points_[node].x - p.x;
+            double dy = points_[node].y - p.y;
+            double distance2 = dx * dx + dy * dy;
+            if (distance2 < best_distance2 || (distance2 == best_distance2 && node < best)) {
+                best_distance2 = distance2;
+                best = node;
+            }
+        }
+    };
+
+    for (int ring = 0; ring <= max_ring; ++ring) {
+        int x0 = cx - ring, x1 = cx + ring, y0 = cy - ring, y1 = cy + ring;
+        for (int y = std::max(y0, 0); y <= std::min(y1, rows_ - 1); ++y) {
+            if (y == y0 || y == y1) {
+                // Lignes du bord de l'anneau : toutes les colonnes
+                for (int x = std::max(x0, 0); x <= std::min(x1, columns_ - 1); ++x) {
+                    scan_cell(x, y);
+                }
+            } else {
+                // Lignes intérieures : seulement les deux colonnes extrêmes
+                if (x0 >= 0) {
+                    scan_cell(x0, y);
+                }
+                if (x1 < columns_) {
+                    scan_cell(x1, y);
+                }
+            }
+        }
+        // Tout nœud d'un anneau plus lointain est au moins à ring * cellSize_
+        double reach = ring * cellSize_;
+        if (best != -1 && best_distance2 <= reach * reach) {
+            break;
+        }
+    }
+    return best;
+}
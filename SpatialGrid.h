@@ -0,0 +1,48 @@
+#ifndef SPATIAL_GRID_H
+#define SPATIAL_GRID_H
+
+#include <vector>
+
+#include "Geometry.h"
+
+// Grille uniforme sur les coordonnées des nœuds, avec suppression.
+// Chaque cellule contient en moyenne deux nœuds ; la recherche du plus proche
+// nœud restant parcourt des anneaux de cellules autour du point jusqu'à ce
+// qu'aucune cellule plus lointaine ne puisse contenir mieux.
+class SpatialGrid {
+public:
+    // Construit la grille en O(N) ; les points doivent survivre à la grille
+    explicit SpatialGrid(const std::vector<Point>& points);
+
+    // Retire un nœud de la grille en O(1)
+    void remove(int node);
+
+    // Nombre de nœuds encore présents
+    int remaining() const { return remaining_; }
+
+    // Plus proche nœud encore présent (distance euclidienne), -1 si la grille est vide
+    int nearest(const Point& p) const;
+
+private:
+    const std::vector<Point>& points_;
+    double minX_ = 0.0;
+    double minY_ = 0.0;
+    double cellSize_ = 1.0;
+    int columns_ = 1;
+    int rows_ = 1;
+    int remaining_ = 0;
+
+    // Nœuds rangés cellule par cellule : les nœuds présents de la cellule c occupent
+    // items_[cellStart_[c], cellStart_[c] + cellCount_[c])
+    std::vector<int> cellStart_;
+    std::vector<int> cellCount_;
+    std::vector<int> items_;
+    std::vector<int> slotOf_; // Position de chaque nœud dans items_
+    std::vector<int> cellOf_; // Cellule de chaque nœud
+
+    // Coordonnées de cellule d'un point (bornées à la grille)
+    int columnOf(double x) const;
+    int rowOf(double y) const;
+};
+
+#endif
@@ -0,0 +1,97 @@
+#include "Stats.h"
+#include <atomic>
+#include <iomanip> // Pour std::setw, std::setprecision
+
+namespace {
+
+// Totaux de tous les threads
+std::atomic<long long> g_counters[Stats::CounterCount];
+std::atomic<long long> g_phaseNanos[Stats::PhaseCount];
+std::atomic<long long> g_phaseCalls[Stats::PhaseCount];
+
+const char* const kCounterNames[Stats::CounterCount] = {
+    "moves_evaluated", "moves_applied", "kicks", "tour_copies", "distance_recalculations", "distance_lookups"
+};
+
+const char* const kPhaseNames[Stats::PhaseCount] = {
+    "parse", "matrix", "candidates", "construction", "two_opt", "or_opt", "lin_kernighan", "iterated_search",
+    "lower_bound", "exact", "decomposition"
+};
+
+} // namespace
+
+// Vrai si l'instrumentation est compilée
+bool Stats::enabled() {
+#ifndef TSP_DISABLE_STATS
+    return true;
+#else
+    return false;
+#endif
+}
+
+// Ajoute les valeurs du thread courant aux totaux globaux
+void Stats::flushThread() {
+    for (int i = 0; i < CounterCount; ++i) {
+        if (threadCounters()[i] != 0) {
+            g_counters[i].fetch_add(threadCounters()[i], std::memory_order_relaxed);
+            threadCounters()[i] = 0;
+        }
+    }
+    for (int i = 0; i < PhaseCount; ++i) {
+        if (threadPhaseCalls()[i] != 0) {
+            g_phaseNanos[i].fetch_add(threadPhaseNanos()[i], std::memory_order_relaxed);
+            g_phaseCalls[i].fetch_add(threadPhaseCalls()[i], std::memory_order_relaxed);
+            threadPhaseNanos()[i] = 0;
+            threadPhaseCalls()[i] = 0;
+        }
+    }
+}
+
+// Affiche les totaux en texte
+void Stats::print(std::ostream& out) {
+    if (!enabled()) {
+        out << "Statistiques indisponibles (compilé avec TSP_DISABLE_STATS)." << std::endl;
+        return;
+    }
+    flushThread();
+    out << "Statistiques :" << std::endl;
+    std::ios::fmtflags flags = out.flags();
+    out << std::fixed << std::setprecision(3);
+    for (int i = 0; i < PhaseCount; ++i) {
+        long long calls = g_phaseCalls[i].load();
+        if (calls > 0) {
+            out << "  " << std::left << std::setw(24) << kPhaseNames[i] << std::right << std::setw(12)
+                << g_phaseNanos[i].load() / 1e6 << " ms  (" << calls << " appels)" << std::endl;
+        }
+    }
+    for (int i = 0; i < CounterCount; ++i) {
+        out << "  " << std::left << std::setw(24) << kCounterNames[i] << std::right << std::setw(12)
+            << g_counters[i].load() << std::endl;
+    }
+    out.flags(flags);
+}
+
+// Affiche les totaux en JSON sur une ligne
+void Stats::printJson(std::ostream& out) {
+    if (!enabled()) {
+        out << "{\"stats\": null}" << std::endl;
+        return;
+    }
+    flushThread();
+    std::ios::fmtflags flags = out.flags();
+    out << std::fixed << std::setprecision(3);
+    out << "{\"phases_ms\": {";
+    for (int i = 0; i < PhaseCount; ++i) {
+        out << (i ? ", " : "") << "\"" << kPhaseNames[i] << "\": " << g_phaseNanos[i].load() / 1e6;
+    }
+    out << "}, \"phase_calls\": {";
+    for (int i = 0; i < PhaseCount; ++i) {
+        out << (i ? ", " : "") << "\"" << kPhaseNames[i] << "\": " << g_phaseCalls[i].load();
+    }
+    out << "}, \"counters\": {";
+    for (int i = 0; i < CounterCount; ++i) {
+        out << (i ? ", " : "") << "\"" << kCounterNames[i] << "\": " << g_counters[i].load();
+    }
+    out << "}}" << std::endl;
+    out.flags(flags);
+}
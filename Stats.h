@@ -0,0 +1,98 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include <chrono>
+#include <iostream>
+
+// Instrumentation légère : compteurs et chronomètres par phase.
+// Chaque thread incrémente ses propres tableaux (thread_local, sans verrou ni
+// atomique) ; flushThread() les ajoute aux totaux globaux, ce que parallelFor fait
+// à la fin de chaque thread de travail. Compiler avec -DTSP_DISABLE_STATS
+// (make STATS=0) supprime toute l'instrumentation : les macros ne génèrent rien.
+class Stats {
+public:
+    // Compteurs
+    enum Counter {
+        MovesEvaluated,          // Mouvements dont le gain a été évalué
+        MovesApplied,            // Mouvements améliorants appliqués
+        Kicks,                   // Perturbations de la recherche locale itérée
+        TourCopies,              // Copies d'objets Tour
+        DistanceRecalculations,  // Appels à Tour::recalculateDistance
+        DistanceLookups,         // Appels à Graph::distance
+        CounterCount
+    };
+
+    // Phases chronométrées (temps cumulé sur tous les threads)
+    enum Phase {
+        Parse,
+        Matrix,
+        Candidates,
+        Construction,    // Multi-départ du plus proche voisin
+        TwoOpt,          // Passes 2-opt
+        OrOpt,           // Passes Or-opt / 3-opt restreint
+        LinKernighan,
+        IteratedSearch,  // Recherche locale itérée
+        LowerBound,      // Borne de Held-Karp (ascension par sous-gradient)
+        Exact,           // Résolution exacte (programmation dynamique, séparation et évaluation)
+        Decomposition,   // Découpage en grappes et assemblage des sous-tournées
+        PhaseCount
+    };
+
+    // Vrai si l'instrumentation est compilée
+    static bool enabled();
+
+    // Incrémente un compteur du thread courant
+    static void add(Counter counter, long long amount = 1) { threadCounters()[counter] += amount; }
+
+    // Ajoute une durée à une phase du thread courant
+    static void addTime(Phase phase, long long nanoseconds) {
+        threadPhaseNanos()[phase] += nanoseconds;
+        threadPhaseCalls()[phase] += 1;
+    }
+
+    // Ajoute les valeurs du thread courant aux totaux globaux et les remet à zéro
+    static void flushThread();
+
+    // Affiche les totaux (après flushThread() du thread appelant) : texte ou JSON sur une ligne
+    static void print(std::ostream& out);
+    static void printJson(std::ostream& out);
+
+    // Chronomètre une portée et ajoute sa durée à la phase
+    class ScopedTimer {
+    public:
+        explicit ScopedTimer(Phase phase) : phase_(phase), start_(std::chrono::steady_clock::now()) {}
+        ~ScopedTimer() {
+            addTime(phase_, std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now() - start_).count());
+        }
+
+    private:
+        Phase phase_;
+        std::chrono::steady_clock::time_point start_;
+    };
+
+private:
+    // Tableaux du thread courant : initialisés à zéro statiquement, sans garde d'accès
+    static long long* threadCounters() {
+        static thread_local long long counters[CounterCount];
+        return counters;
+    }
+    static long long* threadPhaseNanos() {
+        static thread_local long long nanos[PhaseCount];
+        return nanos;
+    }
+    static long long* threadPhaseCalls() {
+        static thread_local long long calls[PhaseCount];
+        return calls;
+    }
+};
+
+#ifndef TSP_DISABLE_STATS
+#define TSP_STATS_ADD(counter, amount) Stats::add(Stats::counter, amount)
+#define TSP_STATS_TIMER(phase) Stats::ScopedTimer tsp_stats_timer_##phase(Stats::phase)
+#else
+#define TSP_STATS_ADD(counter, amount) ((void)0)
+#define TSP_STATS_TIMER(phase) ((void)0)
+#endif
+
+#endif
@@ -1,11 +1,24 @@
 #include "Tour.h"
 #include "Graph.h" // Inclusion complète du Graph dans le fichier .cpp
-#include <algorithm> // Pour std::swap
+#include <algorithm> // Pour std::swap, std::max
+#include <fstream>   // Pour Tour::save
+#include <limits>    // Pour std::numeric_limits
+#include "Stats.h"
 
 // Constructeur
 Tour::Tour(const std::vector<int>& nodes, const Graph& graph)
     : nodes_(nodes), totalDistance_(0) { // Initialise nodes_ et totalDistance_
-    
+
+    // Table inverse : position de chaque nœud dans la séquence
+    int max_node = -1;
+    for (int node : nodes_) {
+        max_node = std::max(max_node, node);
+    }
+    positions_.assign(max_node + 1, -1);
+    for (size_t i = 0; i < nodes_.size(); ++i) {
+        positions_[nodes_[i]] = static_cast<int>(i);
+    }
+
     // Une tournée n'a de sens (et de distance > 0) qu'avec au moins 2 nœuds pour un aller-retour complet
     if (nodes_.size() < 2) {
         totalDistance_ = 0;
@@ -18,13 +31,28 @@ Tour::Tour(const std::vector<int>& nodes, const Graph& graph)
         int current_node = nodes_[i];
         int next_node = nodes_[i+1];
         // Ajouter la distance entre le nœud actuel et le suivant
-        totalDistance_ += graph.getDistance(current_node, next_node);
+        totalDistance_ += graph.distance(current_node, next_node);
     }
 
     // Ajouter la distance de retour du dernier nœud au premier (fermeture de la tournée)
     int last_node = nodes_.back(); // Le dernier élément du vecteur
     int first_node = nodes_.front(); // Le premier élément du vecteur
-    totalDistance_ += graph.getDistance(last_node, first_node);
+    totalDistance_ += graph.distance(last_node, first_node);
+}
+
+// Constructeur de copie
+Tour::Tour(const Tour& other)
+    : nodes_(other.nodes_), positions_(other.positions_), totalDistance_(other.totalDistance_) {
+    TSP_STATS_ADD(TourCopies, 1);
+}
+
+// Affectation par copie
+Tour& Tour::operator=(const Tour& other) {
+    TSP_STATS_ADD(TourCopies, 1);
+    nodes_ = other.nodes_;
+    positions_ = other.positions_;
+    totalDistance_ = other.totalDistance_;
+    return *this;
 }
 
 // Affiche la séquence des nœuds et la distance totale
@@ -38,6 +66,32 @@ void Tour::print() const {
     std::cout << "Distance totale : " << totalDistance_ << std::endl;
 }
 
+// Écrit la tournée dans un fichier
+bool Tour::save(const std::string& filename, const std::vector<Point>& coords) const {
+    std::ofstream outfile(filename);
+    if (!outfile.is_open()) {
+        return false;
+    }
+    // Format simple : distance totale, puis séquence des nœuds
+    outfile << "TOUR_DISTANCE : " << totalDistance_ << "\n";
+    outfile << "TOUR_NODES :" << "\n";
+    for (int node : nodes_) {
+        outfile << node + 1 << "\n";
+    }
+    outfile << -1 << "\n"; // Marqueur de fin de séquence (convention TSPLIB)
+    if (!coords.empty()) {
+        // Assez de chiffres pour relire exactement les mêmes valeurs
+        outfile.precision(std::numeric_limits<double>::max_digits10);
+        outfile << "TOUR_COORDS :" << "\n";
+        for (int node : nodes_) {
+            outfile << coords[node].x << " " << coords[node].y << "\n";
+        }
+        outfile << "EOF" << "\n";
+    }
+    outfile.close();
+    return static_cast<bool>(outfile);
+}
+
 // Inverse une sous-séquence de la tournée
 void Tour::reverseSubsequence(int start, int end) {
     if (start >= end) {
@@ -45,19 +99,62 @@ void Tour::reverseSubsequence(int start, int end) {
     }
     while (start < end) {
         std::swap(nodes_[start], nodes_[end]);
+        positions_[nodes_[start]] = start;
+        positions_[nodes_[end]] = end;
         start++;
         end--;
     }
 }
 
+// Inverse le chemin circulaire des positions from à to (incluses)
+void Tour::reversePath(int from, int to) {
+    int n = size();
+    int length = to - from;
+    if (length < 0) {
+        length += n;
+    }
+    length += 1;
+    for (int k = 0; k < length / 2; ++k) {
+        std::swap(nodes_[from], nodes_[to]);
+        positions_[nodes_[from]] = from;
+        positions_[nodes_[to]] = to;
+        from = (from + 1 == n) ? 0 : from + 1;
+        to = (to == 0) ? n - 1 : to - 1;
+    }
+}
+
+// Mouvement 2-opt appliqué sur place
+void Tour::twoOptMove(int a, int b, int c, int d, long delta) {
+    // Se ramener au sens où b suit a et d suit c
+    if (next(a) != b) {
+        std::swap(a, b);
+        std::swap(c, d);
+    }
+
+    // Inverser b..c ou, de façon équivalente, d..a : on choisit le plus court
+    int n = size();
+    int inner = positions_[c] - positions_[b];
+    if (inner < 0) {
+        inner += n;
+    }
+    inner += 1;
+    if (2 * inner <= n) {
+        reversePath(positions_[b], positions_[c]);
+    } else {
+        reversePath(positions_[d], positions_[a]);
+    }
+    totalDistance_ += delta;
+}
+
 // Recalcul la distance de l'objet
 void Tour::recalculateDistance(const Graph& graph) {
+    TSP_STATS_ADD(DistanceRecalculations, 1);
     totalDistance_ = 0;
     if (nodes_.size() < 2) {
         return;
     }
     for (size_t i = 0; i < nodes_.size() - 1; ++i) {
-        totalDistance_ += graph.getDistance(nodes_[i], nodes_[i + 1]);
+        totalDistance_ += graph.distance(nodes_[i], nodes_[i + 1]);
     }
-    totalDistance_ += graph.getDistance(nodes_.back(), nodes_.front());
+    totalDistance_ += graph.distance(nodes_.back(), nodes_.front());
 }
\ No newline at end of file
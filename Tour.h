@@ -3,8 +3,11 @@
 
 #include <vector>
 #include <iostream>
+#include <string>
 #include <numeric> // Pour std::accumulate ou simplement une boucle
 
+#include "Geometry.h"
+
 // Déclaration anticipée de la classe Graph pour éviter une dépendance circulaire
 class Graph;
 
@@ -13,16 +16,44 @@ public:
     // Constructeur : prend la séquence de nœuds et une référence au graphe
     // pour calculer la distance totale.
     Tour(const std::vector<int>& nodes, const Graph& graph);
-    Tour(const Tour& other) = default; // Copie par défaut
-    Tour& operator=(const Tour& other) = default;
+    // Copies comptées par l'instrumentation ; les déplacements ne copient rien
+    Tour(const Tour& other);
+    Tour& operator=(const Tour& other);
+    Tour(Tour&& other) = default;
+    Tour& operator=(Tour&& other) = default;
 
     // Getters
     const std::vector<int>& getNodes() const { return nodes_; }
-    int getTotalDistance() const { return totalDistance_; }
+    long getTotalDistance() const { return totalDistance_; }
+    int size() const { return static_cast<int>(nodes_.size()); }
+
+    // Position d'un nœud dans la séquence, et ses voisins dans la tournée
+    int getPosition(int node) const { return positions_[node]; }
+    int next(int node) const {
+        int position = positions_[node] + 1;
+        return nodes_[position == size() ? 0 : position];
+    }
+    int prev(int node) const {
+        int position = positions_[node];
+        return nodes_[position == 0 ? size() - 1 : position - 1];
+    }
+
+    // Mouvement 2-opt appliqué sur place : retire les arêtes (a, b) et (c, d),
+    // où b suit a et d suit c dans un même sens de parcours, et ajoute (a, c) et (b, d).
+    // Seul le plus court des deux chemins est inversé ; delta est la variation de
+    // longueur, ajoutée à la distance totale sans la recalculer.
+    void twoOptMove(int a, int b, int c, int d, long delta);
 
     // Affiche la séquence des nœuds de la tournée et sa distance totale.
     void print() const;
 
+    // Écrit la tournée dans un fichier : distance totale, puis nœuds (1-basés)
+    // terminés par -1 (convention TSPLIB). Avec coords (coordonnées de tous les nœuds),
+    // une section TOUR_COORDS suit le -1 : les coordonnées de chaque nœud de la tournée,
+    // qui permettent de la reprendre sur une instance modifiée (WarmStart).
+    // Faux si le fichier ne peut être écrit.
+    bool save(const std::string& filename, const std::vector<Point>& coords = std::vector<Point>()) const;
+
     // Inverse une sous-séquence de la tournée
     void reverseSubsequence(int start, int end);
 
@@ -30,8 +61,12 @@ public:
     void recalculateDistance(const Graph& graph);
 
 private:
-    std::vector<int> nodes_; // Séquence des indices des nœuds
-    int totalDistance_;      // Distance totale de la tournée
+    std::vector<int> nodes_;     // Séquence des indices des nœuds
+    std::vector<int> positions_; // Position de chaque nœud dans nodes_
+    long totalDistance_;         // Distance totale de la tournée (64 bits : dépasse 2^31 sur les grandes instances)
+
+    // Inverse le chemin circulaire des positions from à to (incluses), en avançant
+    void reversePath(int from, int to);
 };
 
 #endif
\ No newline at end of file
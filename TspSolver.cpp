@@ -1,43 +1,75 @@
 #include "TspSolver.h"
+#include "LocalSearch.h"
+#include "LinKernighan.h"
+#include "Parallel.h"
+#include "SpatialGrid.h"
+#include "Stats.h"
+#include "DistancePolicy.h"
+#include "ExactSolver.h"
+#include "Construction.h"
+#include "BestImprovementTwoOpt.h"
+#include "Decomposition.h"
 #include <limits> // Nécessaire pour std::numeric_limits
-#include <algorithm> // Potentiellement pour std::min, mais une simple comparaison suffit
+#include <algorithm> // Pour std::min, std::sort, std::upper_bound
+#include <random>    // Pour le tirage des nœuds de départ
+
+// Au-delà de cette dimension, le multi-départ par défaut n'essaie plus tous les nœuds
+static const int kAllStartsLimit = 2000;
+
+// Nombre minimal de départs échantillonnés par défaut pour les grandes instances
+static const int kDefaultSampledStarts = 8;
+
+// Longueur maximale de chacun des deux segments échangés par une perturbation
+static const int kKickSegmentLength = 50;
+
+// Nombre de perturbations entre deux consultations de la meilleure tournée commune
+static const int kMigrationInterval = 256;
+
+// Avec une longueur cible pour seul critère d'arrêt, la recherche itérée s'arrête
+// après ce nombre de perturbations par nœud
+static const long kTargetIterationsPerNode = 20;
 
 // Constructeur
 TspSolver::TspSolver(const Graph& graph) : graph_(graph) {
     // Le constructeur stocke simplement la référence au graphe.
 }
 
-// Méthode principale pour lancer la résolution
-Tour TspSolver::solve() const {
-    // Pour l'instant, solve() appelle simplement l'algorithme du plus proche voisin
-    // Plus tard, on pourrait ajouter d'autres algorithmes ici et choisir lequel exécuter
-    Tour result_tour = nearestNeighborSolve(0);
-    for(int i = 1; i<graph_.getDimension(); ++i) {
-        Tour tour_i = nearestNeighborSolve(i);
-        if (tour_i.getTotalDistance() < result_tour.getTotalDistance())
-            result_tour = tour_i;
-    }
+TspSolver::TspSolver(const Graph& graph, const Options& options) : graph_(graph), options_(options) {}
 
-    // Amélioration du tour par une optimisation
-    result_tour = OptimizationSwapEdges(result_tour);
+// Nombre de threads effectif
+int TspSolver::threadCount() const {
+    return options_.threads > 0 ? options_.threads : hardwareThreads();
+}
 
-    return result_tour;
+// Signale une tournée au rappel d'amélioration si elle est plus courte que la dernière
+// signalée ; le verrou garantit des appels sérialisés et des longueurs décroissantes
+void TspSolver::reportImprovement(const Tour& tour) const {
+    if (!options_.onImprovement) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(reportMutex_);
+    if (reportedLength_ == 0 || tour.getTotalDistance() < reportedLength_) {
+        reportedLength_ = tour.getTotalDistance();
+        options_.onImprovement(tour);
+    }
 }
 
-// Implémentation de l'algorithme du plus proche voisin
-Tour TspSolver::nearestNeighborSolve(int start_node) const {
-    int dimension = graph_.getDimension();
+namespace {
 
-    // Vérification de base pour un graphe valide
-    if (dimension <= 1) {
-        // Pour 0 ou 1 nœud, la tournée est triviale
-        std::vector<int> trivial_tour;
-        if (dimension == 1) {
-            trivial_tour.push_back(0); // Tournée [0] pour 1 nœud
-        }
-        return Tour(trivial_tour, graph_); // Créer et retourner la tournée triviale
+// Ordre strict (distance, rang) : la réduction ne dépend pas de l'ordonnancement des threads
+struct RankedTour {
+    int rank;
+    Tour tour;
+    bool operator<(const RankedTour& other) const {
+        return tour.getTotalDistance() < other.tour.getTotalDistance() ||
+               (tour.getTotalDistance() == other.tour.getTotalDistance() && rank < other.rank);
     }
+};
 
+// Plus proche voisin depuis start_node, spécialisé pour une politique de distance
+template <typename Distance>
+std::vector<int> nearestNeighborPath(const CandidateSet& candidates, int dimension, int start_node,
+                                     const Distance& dist) {
     std::vector<int> tour_nodes; // Pour stocker la séquence des nœuds visités
     std::vector<bool> visited(dimension, false); // Pour suivre quels nœuds ont été visités
 
@@ -52,17 +84,38 @@ Tour TspSolver::nearestNeighborSolve(int start_node) const {
         int min_distance = std::numeric_limits<int>::max(); // Initialiser la distance minimale à une très grande valeur
         int nearest_neighbor = -1; // Pour stocker l'indice du voisin le plus proche
 
-        // Rechercher le voisin non visité le plus proche du nœud actuel
-        for (int neighbor_node = 0; neighbor_node < dimension; ++neighbor_node) {
-            // Vérifier si le nœud voisin n'a pas encore été visité
-            if (!visited[neighbor_node]) {
-                // Obtenir la distance entre le nœud actuel et le nœud voisin
-                int distance = graph_.getDistance(current_node, neighbor_node);
-
-                // Si cette distance est plus petite que la distance minimale trouvée jusqu'à présent
-                if (distance != -1 && distance < min_distance) { // S'assurer que la distance est valide (-1 indique une erreur)
-                    min_distance = distance;
-                    nearest_neighbor = neighbor_node;
+        // Les candidats sont triés par distance croissante : le premier non visité
+        // est le plus proche voisin non visité, inutile de parcourir tous les nœuds
+        // (listes dans un autre ordre : le plus proche des candidats non visités)
+        if (!candidates.empty()) {
+            for (const int* c = candidates.begin(current_node); c != candidates.end(current_node); ++c) {
+                if (!visited[*c]) {
+                    if (candidates.isSortedByDistance()) {
+                        nearest_neighbor = *c;
+                        break;
+                    }
+                    int distance = dist(current_node, *c);
+                    if (distance < min_distance) {
+                        min_distance = distance;
+                        nearest_neighbor = *c;
+                    }
+                }
+            }
+        }
+
+        // Sinon, rechercher le voisin non visité le plus proche parmi tous les nœuds
+        if (nearest_neighbor == -1) {
+            for (int neighbor_node = 0; neighbor_node < dimension; ++neighbor_node) {
+                // Vérifier si le nœud voisin n'a pas encore été visité
+                if (!visited[neighbor_node]) {
+                    // Obtenir la distance entre le nœud actuel et le nœud voisin
+                    int distance = dist(current_node, neighbor_node);
+
+                    // Si cette distance est plus petite que la distance minimale trouvée jusqu'à présent
+                    if (distance < min_distance) {
+                        min_distance = distance;
+                        nearest_neighbor = neighbor_node;
+                    }
                 }
             }
         }
@@ -82,6 +135,301 @@ Tour TspSolver::nearestNeighborSolve(int start_node) const {
         }
     }
 
+    return tour_nodes;
+}
+
+} // namespace
+
+// Méthode principale pour lancer la résolution
+Tour TspSolver::solve() const {
+    provenOptimal_ = false;
+    reportedLength_ = 0;
+    int n = graph_.getDimension();
+    if (options_.clusterSize > 0 && n > options_.clusterSize && warmStart_.empty()) {
+        if (!graph_.getNodeCoords().empty()) {
+            return solveDecomposed();
+        }
+        std::cerr << "Avertissement: Décomposition impossible sans coordonnées, "
+                  << "résolution directe." << std::endl;
+    }
+    if (n > options_.exactLimit || n > ExactSolver::kBranchAndBoundLimit) {
+        return solveHeuristic();
+    }
+
+    // Petite instance : résolution exacte
+    ExactSolver exact(graph_);
+    exact.setThreadCount(threadCount());
+    exact.setCancellation(options_.cancellation);
+    std::vector<int> order;
+    if (exact.solveDynamicProgramming(order)) {
+        provenOptimal_ = true;
+        Tour tour(order, graph_);
+        reportImprovement(tour);
+        return tour;
+    }
+    // Séparation et évaluation, bornée par la meilleure tournée heuristique
+    Tour tour = solveHeuristic();
+    order = tour.getNodes();
+    provenOptimal_ = exact.solveBranchAndBound(order);
+    if (order == tour.getNodes()) {
+        return tour;
+    }
+    Tour exact_tour(order, graph_);
+    reportImprovement(exact_tour);
+    return exact_tour;
+}
+
+// Décomposition géométrique : grappes résolues en parallèle, assemblage et réparation
+Tour TspSolver::solveDecomposed() const {
+    Decomposition decomposition(graph_);
+    decomposition.setClusterSize(options_.clusterSize);
+    decomposition.setThreadCount(threadCount());
+    decomposition.setSubSolverOptions(options_);
+    Tour tour = decomposition.solve();
+    reportImprovement(tour);
+    return tour;
+}
+
+// Multi-départ, amélioration locale puis recherche itérée
+Tour TspSolver::solveHeuristic() const {
+    const auto start_time = std::chrono::steady_clock::now();
+    if (graph_.getDimension() <= 1) {
+        return nearestNeighborSolve(0);
+    }
+
+    std::vector<RankedTour> improved;
+    if (static_cast<int>(warmStart_.size()) == graph_.getDimension()) {
+        // 1-2. Départ à chaud : réoptimisation autour des changements seulement
+        improved.push_back(RankedTour{0, improveWarmStart()});
+        reportImprovement(improved.front().tour);
+    } else {
+        // 1. Multi-départ du plus proche voisin
+        std::vector<Tour> best_starts = constructStartTours();
+        int top_k = static_cast<int>(best_starts.size());
+        reportImprovement(best_starts.front()); // Première réponse, avant toute amélioration
+
+        // 2. Amélioration des topK meilleures tournées de départ, en parallèle
+        // (le rang d'une tournée est sa place parmi les tournées de départ)
+        for (int index = 0; index < top_k; ++index) {
+            improved.push_back(RankedTour{index, best_starts[index]});
+        }
+        parallelFor(top_k, std::min(threadCount(), top_k), [&](int index, int) {
+            improved[index].tour = improveTour(best_starts[index]);
+            reportImprovement(improved[index].tour);
+        });
+    }
+    int top_k = static_cast<int>(improved.size());
+
+    std::sort(improved.begin(), improved.end());
+    const Tour& best = improved.front().tour;
+    if (options_.targetLength > 0 && best.getTotalDistance() <= options_.targetLength) {
+        return best; // Déjà assez proche de l'optimum
+    }
+    if (isCancelled()) {
+        return best;
+    }
+
+    // 3. Recherche locale itérée dans le budget imparti : une île par thread, partant
+    // des meilleures tournées améliorées à tour de rôle
+    long iterations = options_.iterationLimit;
+    if (options_.timeLimit <= 0.0 && iterations == 0 && options_.targetLength > 0) {
+        iterations = kTargetIterationsPerNode * graph_.getDimension();
+    }
+    if (options_.timeLimit > 0.0 || iterations > 0) {
+        auto deadline = options_.timeLimit > 0.0
+            ? start_time + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                               std::chrono::duration<double>(options_.timeLimit))
+            : std::chrono::steady_clock::time_point::max();
+        int islands = std::max(1, threadCount());
+        if (islands == 1) {
+            return iteratedLocalSearch(best, deadline, iterations, options_.seed, nullptr);
+        }
+        SharedBestTour shared(best);
+        parallelFor(islands, islands, [&](int island, int) {
+            iteratedLocalSearch(improved[island % top_k].tour, deadline, iterations,
+                                options_.seed + static_cast<unsigned>(island) * 0x9e3779b9u, &shared);
+        });
+        return shared.get();
+    }
+    return best;
+}
+
+// Convertit un nom d'heuristique de construction
+bool TspSolver::parseConstruction(const std::string& name, Construction& construction) {
+    if (name == "nearest") {
+        construction = Construction::NearestNeighbor;
+    } else if (name == "greedy") {
+        construction = Construction::GreedyEdge;
+    } else if (name == "hilbert") {
+        construction = Construction::SpaceFillingCurve;
+    } else if (name == "christofides") {
+        construction = Construction::Christofides;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// Nom de l'heuristique de construction
+const char* TspSolver::constructionName(Construction construction) {
+    switch (construction) {
+    case Construction::GreedyEdge:
+        return "greedy";
+    case Construction::SpaceFillingCurve:
+        return "hilbert";
+    case Construction::Christofides:
+        return "christofides";
+    default:
+        return "nearest";
+    }
+}
+
+// Multi-départ du plus proche voisin, réparti entre les threads.
+// Chaque thread garde ses topK meilleures tournées, sans synchronisation.
+std::vector<Tour> TspSolver::constructStartTours() const {
+    TSP_STATS_TIMER(Construction);
+    if (graph_.getDimension() <= 1) {
+        return std::vector<Tour>(1, nearestNeighborSolve(0));
+    }
+
+    // Heuristiques déterministes : une seule tournée de départ
+    std::vector<int> order;
+    switch (options_.construction) {
+    case Construction::GreedyEdge:
+        order = greedyEdgeTour(graph_);
+        break;
+    case Construction::Christofides:
+        order = christofidesTour(graph_);
+        break;
+    case Construction::SpaceFillingCurve:
+        if (!graph_.getNodeCoords().empty()) {
+            order = spaceFillingCurveTour(graph_.getNodeCoords());
+        } else {
+            std::cerr << "Avertissement: Courbe de Hilbert impossible sans coordonnées, "
+                      << "plus proche voisin utilisé." << std::endl;
+        }
+        break;
+    default:
+        break;
+    }
+    if (!order.empty()) {
+        return std::vector<Tour>(1, Tour(order, graph_));
+    }
+
+    std::vector<int> starts = chooseStartNodes();
+    int top_k = std::max(1, std::min(options_.topK, static_cast<int>(starts.size())));
+    int workers = std::max(1, std::min(threadCount(), static_cast<int>(starts.size())));
+    std::vector<std::vector<RankedTour>> best_per_worker(workers);
+
+    parallelFor(static_cast<int>(starts.size()), workers, [&](int index, int worker) {
+        std::vector<RankedTour>& best = best_per_worker[worker];
+        if (isCancelled() && !best.empty()) {
+            return; // Annulation : chaque thread garde ce qu'il a déjà construit
+        }
+        RankedTour candidate{index, nearestNeighborSolve(starts[index])};
+        if (static_cast<int>(best.size()) < top_k || candidate < best.back()) {
+            best.insert(std::upper_bound(best.begin(), best.end(), candidate), candidate);
+            if (static_cast<int>(best.size()) > top_k) {
+                best.pop_back();
+            }
+        }
+    });
+
+    // Réduction déterministe : fusion puis tri selon (distance, rang du départ)
+    std::vector<RankedTour> best_starts;
+    for (const std::vector<RankedTour>& best : best_per_worker) {
+        best_starts.insert(best_starts.end(), best.begin(), best.end());
+    }
+    std::sort(best_starts.begin(), best_starts.end());
+    best_starts.resize(top_k, best_starts.front());
+
+    std::vector<Tour> tours;
+    for (const RankedTour& ranked : best_starts) {
+        tours.push_back(ranked.tour);
+    }
+    return tours;
+}
+
+// Nœuds de départ de la phase multi-départ
+std::vector<int> TspSolver::chooseStartNodes() const {
+    int dimension = graph_.getDimension();
+    std::vector<int> starts(dimension);
+    for (int i = 0; i < dimension; ++i) {
+        starts[i] = i;
+    }
+    int sample_size = options_.startSampleSize;
+    if (sample_size == 0 && dimension > kAllStartsLimit) {
+        // Chaque départ coûte au moins O(N) : on se limite à quelques départs par thread
+        sample_size = std::max(kDefaultSampledStarts, threadCount());
+    }
+    if (sample_size > 0 && sample_size < dimension) {
+        // Tirage sans remise reproductible (mélange partiel de Fisher-Yates)
+        std::mt19937 rng(options_.seed);
+        for (int i = 0; i < sample_size; ++i) {
+            std::uniform_int_distribution<int> pick(i, dimension - 1);
+            std::swap(starts[i], starts[pick(rng)]);
+        }
+        starts.resize(sample_size);
+    }
+    return starts;
+}
+
+// Applique le moteur d'amélioration choisi à une tournée de départ
+Tour TspSolver::improveTour(const Tour& tour) const {
+    Tour result_tour = options_.engine == Engine::LinKernighan ? OptimizationLinKernighan(tour)
+                       : options_.engine == Engine::BestTwoOpt ? OptimizationBestTwoOpt(tour)
+                                                               : OptimizationSwapEdges(tour);
+    return OptimizationMoveSegments(result_tour);
+}
+
+// Amélioration de la tournée de départ fournie : les bits don't-look des seuls nœuds
+// changés sont remis à zéro, le reste de la tournée n'est revu que si un mouvement l'atteint
+Tour TspSolver::improveWarmStart() const {
+    Tour tour(warmStart_, graph_);
+    if (warmStartChanged_.empty()) {
+        return tour; // Instance inchangée
+    }
+    if (options_.engine == Engine::LinKernighan) {
+        TSP_STATS_TIMER(LinKernighan);
+        LinKernighan engine(graph_);
+        engine.setCancellation(options_.cancellation);
+        tour = engine.optimize(tour, warmStartChanged_);
+    }
+    TSP_STATS_TIMER(OrOpt);
+    LocalSearch search(graph_);
+    search.setCancellation(options_.cancellation);
+    for (int node : warmStartChanged_) {
+        search.activate(node);
+    }
+    search.optimize(tour, LocalSearch::AllOperators);
+    return tour;
+}
+
+// Implémentation de l'algorithme du plus proche voisin
+Tour TspSolver::nearestNeighborSolve(int start_node) const {
+    int dimension = graph_.getDimension();
+
+    // Vérification de base pour un graphe valide
+    if (dimension <= 1) {
+        // Pour 0 ou 1 nœud, la tournée est triviale
+        std::vector<int> trivial_tour;
+        if (dimension == 1) {
+            trivial_tour.push_back(0); // Tournée [0] pour 1 nœud
+        }
+        return Tour(trivial_tour, graph_); // Créer et retourner la tournée triviale
+    }
+
+    // Instances à coordonnées : recherche géométrique dans une grille
+    if (!graph_.getNodeCoords().empty()) {
+        return nearestNeighborGridSolve(start_node);
+    }
+
+    // La représentation des distances est choisie une fois, hors de la boucle
+    std::vector<int> tour_nodes; // Pour stocker la séquence des nœuds visités
+    withDistancePolicy(graph_, [&](const auto& dist) {
+        tour_nodes = nearestNeighborPath(graph_.getCandidates(), dimension, start_node, dist);
+    });
+
     // Tous les nœuds devraient être visités à ce stade.
     // Construire l'objet Tour à partir de la séquence trouvée
     Tour result_tour(tour_nodes, graph_);
@@ -89,38 +437,138 @@ Tour TspSolver::nearestNeighborSolve(int start_node) const {
     return result_tour;
 }
 
+// Plus proche voisin géométrique à l'aide d'une grille uniforme
+Tour TspSolver::nearestNeighborGridSolve(int start_node) const {
+    const std::vector<Point>& coords = graph_.getNodeCoords();
+    SpatialGrid grid(coords);
+
+    std::vector<int> tour_nodes;
+    tour_nodes.reserve(coords.size());
+
+    // Les distances EUC_2D et ATT croissent avec la distance euclidienne :
+    // le plus proche voisin géométrique est aussi le plus proche pour le graphe
+    int current_node = start_node;
+    while (current_node != -1) {
+        tour_nodes.push_back(current_node);
+        grid.remove(current_node);
+        current_node = grid.nearest(coords[current_node]);
+    }
+
+    return Tour(tour_nodes, graph_);
+}
+
 // L'algorithme remplace des paires d'arêtes pour réduire la distance totale de la tournée
+// Les mouvements 2-opt sont appliqués sur place (une seule copie de la tournée),
+// limités aux candidats de chaque nœud et guidés par des bits don't-look.
 Tour TspSolver::OptimizationSwapEdges(const Tour& tour) const {
+    TSP_STATS_TIMER(TwoOpt);
     Tour best_tour = tour;
-    bool improved = true;
-    size_t n = best_tour.getNodes().size();
-
-    while (improved) {
-        improved = false;
-        for (size_t i = 0; i < n - 2; ++i) {
-            for (size_t j = i + 2; j < n; ++j) {
-                // Nœuds des arêtes à échanger
-                int a = best_tour.getNodes()[i];
-                int b = best_tour.getNodes()[i + 1];
-                int c = best_tour.getNodes()[j];
-                int d_index = (j == n - 1) ? 0 : j + 1;
-                int d = best_tour.getNodes()[d_index];
-
-                // Calculer la variation de distance
-                int delta = graph_.getDistance(a, c) + graph_.getDistance(b, d) - graph_.getDistance(a, b) - graph_.getDistance(c, d);
-
-                // Si l'échange améliore la tournée
-                if (delta < 0) {
-                    Tour new_tour = best_tour;
-                    new_tour.reverseSubsequence(i + 1, j);
-                    new_tour.recalculateDistance(graph_); // Recalculer la distance
-                    if (new_tour.getTotalDistance() < best_tour.getTotalDistance()) {
-                        best_tour = new_tour;
-                        improved = true;
-                    }
+    LocalSearch search(graph_);
+    search.setCancellation(options_.cancellation);
+    search.activateAll(best_tour);
+    search.twoOpt(best_tour);
+    return best_tour;
+}
+
+// 2-opt exhaustif en meilleure amélioration. Les topK tournées de départ étant déjà
+// améliorées en parallèle, chacune reçoit sa part des threads.
+Tour TspSolver::OptimizationBestTwoOpt(const Tour& tour) const {
+    TSP_STATS_TIMER(TwoOpt);
+    Tour best_tour = tour;
+    BestImprovementTwoOpt engine(graph_);
+    engine.setThreadCount(std::max(1, threadCount() / std::max(1, options_.topK)));
+    engine.setCancellation(options_.cancellation);
+    engine.optimize(best_tour);
+    return best_tour;
+}
+
+// Déplace des segments (Or-opt) et échange des segments consécutifs (3-opt restreint)
+Tour TspSolver::OptimizationMoveSegments(const Tour& tour) const {
+    TSP_STATS_TIMER(OrOpt);
+    Tour best_tour = tour;
+    LocalSearch search(graph_);
+    search.setCancellation(options_.cancellation);
+    search.activateAll(best_tour);
+    search.optimize(best_tour, LocalSearch::AllOperators);
+    return best_tour;
+}
+
+// Recherche à profondeur variable de type Lin-Kernighan
+Tour TspSolver::OptimizationLinKernighan(const Tour& tour) const {
+    TSP_STATS_TIMER(LinKernighan);
+    LinKernighan engine(graph_);
+    engine.setCancellation(options_.cancellation);
+    return engine.optimize(tour);
+}
+
+// Recherche locale itérée à partir d'une tournée localement optimale
+Tour TspSolver::iteratedLocalSearch(const Tour& tour, std::chrono::steady_clock::time_point deadline,
+                                    long iterations, unsigned seed, SharedBestTour* shared) const {
+    TSP_STATS_TIMER(IteratedSearch);
+    Tour current = tour;
+    int n = current.size();
+    if (n < 8) {
+        return current;
+    }
+    LocalSearch search(graph_);
+    search.setCancellation(options_.cancellation);
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> pick_node(0, n - 1);
+    // Deux segments d'au plus kKickSegmentLength nœuds, séparés du reste de la tournée
+    std::uniform_int_distribution<int> pick_length(1, std::max(1, std::min(kKickSegmentLength, (n - 2) / 2)));
+
+    bool improved = false; // Progrès de l'île depuis la dernière migration
+    for (long iteration = 0; iterations == 0 || iteration < iterations; ++iteration) {
+        if (std::chrono::steady_clock::now() >= deadline || isCancelled()) {
+            break;
+        }
+        // Longueur cible atteinte par cette île ou par une autre
+        if (options_.targetLength > 0 && (current.getTotalDistance() <= options_.targetLength ||
+                                          (shared && shared->length() <= options_.targetLength))) {
+            break;
+        }
+        if (shared && iteration % kMigrationInterval == kMigrationInterval - 1) {
+            // Une île qui stagne repart de la meilleure tournée commune
+            if (!improved) {
+                shared->copyIfBetter(current);
+            }
+            improved = false;
+        }
+        long before = current.getTotalDistance();
+        TSP_STATS_ADD(Kicks, 1);
+        search.beginJournal();
+
+        // Double pont local : a b..c d..e f -> a d..e b..c f
+        int a = pick_node(rng);
+        int b = current.next(a);
+        int c = b;
+        for (int k = pick_length(rng); k > 1; --k) {
+            c = current.next(c);
+        }
+        int d = current.next(c);
+        int e = d;
+        for (int k = pick_length(rng); k > 1; --k) {
+            e = current.next(e);
+        }
+        int f = current.next(e);
+        search.segmentExchange(current, a, b, c, d, e, f);
+
+        // Seuls les nœuds autour des arêtes modifiées sont réexaminés
+        search.optimize(current, LocalSearch::AllOperators);
+
+        // À longueur égale, la nouvelle tournée est conservée pour se déplacer sur les plateaux
+        if (current.getTotalDistance() <= before) {
+            search.commitJournal();
+            if (current.getTotalDistance() < before) {
+                improved = true;
+                // Record de l'île seule, ou record commun à toutes les îles
+                if (!shared || shared->offer(current)) {
+                    reportImprovement(current);
                 }
             }
+        } else {
+            search.undoJournal(current);
         }
     }
-    return best_tour;
+    return current;
 }
\ No newline at end of file
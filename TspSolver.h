@@ -3,32 +3,215 @@
 
 #include "Graph.h"
 #include "Tour.h"
+#include "SharedBestTour.h"
+#include "CancellationToken.h"
 
 #include <vector>
 #include <limits> // Pour std::numeric_limits
 #include <iostream>
+#include <chrono>
+#include <string>
+#include <functional>
+#include <mutex>
 
 class TspSolver {
 public:
+    // Moteurs d'amélioration disponibles
+    enum class Engine {
+        Local,        // 2-opt puis Or-opt / 3-opt restreint
+        LinKernighan, // Recherche à profondeur variable (Lin-Kernighan), puis Or-opt
+        BestTwoOpt    // 2-opt exhaustif en meilleure amélioration (noyau AVX2), puis Or-opt
+    };
+
+    // Heuristiques de construction des tournées de départ
+    enum class Construction {
+        NearestNeighbor,   // Plus proche voisin depuis plusieurs départs (multi-départ)
+        GreedyEdge,        // Appariement glouton des arêtes candidates
+        SpaceFillingCurve, // Ordre d'une courbe de Hilbert (coordonnées seulement)
+        Christofides       // Arbre couvrant minimal, couplage des nœuds impairs, circuit eulérien
+    };
+
+    // Dimension maximale par défaut de la résolution exacte
+    static const int kDefaultExactLimit = 30;
+
+    // Appelée avec chaque tournée strictement plus courte que les précédentes
+    using ImprovementCallback = std::function<void(const Tour& tour)>;
+
+    // Options de résolution (API de la bibliothèque) ; les setters ci-dessous en
+    // modifient un champ à la fois et en décrivent le détail
+    struct Options {
+        Engine engine = Engine::Local;
+        Construction construction = Construction::NearestNeighbor;
+        int threads = 0;           // 0 : threads matériels
+        int startSampleSize = 0;
+        int topK = 1;
+        unsigned seed = 1;
+        double timeLimit = 0.0;    // Budget de temps en secondes (0 : aucun)
+        long iterationLimit = 0;
+        long targetLength = 0;
+        int exactLimit = kDefaultExactLimit;
+        int clusterSize = 0;       // Décomposition géométrique au-delà (0 : jamais)
+        // Appels sérialisés (jamais concurrents), depuis le thread qui a trouvé la
+        // tournée : le rappel doit rendre la main vite (copie, signal...)
+        ImprovementCallback onImprovement;
+        // Demande d'arrêt coopérative (nullptr : aucune) ; le jeton doit survivre à solve()
+        const CancellationToken* cancellation = nullptr;
+    };
+
     // Constructeur : prend une référence constante au graphe à résoudre
     TspSolver(const Graph& graph);
+    TspSolver(const Graph& graph, const Options& options);
+
+    const Options& getOptions() const { return options_; }
+    void setOptions(const Options& options) { options_ = options; }
+
+    // Choisit le moteur d'amélioration utilisé par solve()
+    void setEngine(Engine engine) { options_.engine = engine; }
+
+    // Choisit l'heuristique de construction ; hors plus proche voisin, une seule tournée
+    // de départ est construite (les options de départs et topK sont alors sans effet)
+    void setConstruction(Construction construction) { options_.construction = construction; }
+
+    // Convertit un nom ("nearest", "greedy", "hilbert", "christofides") ; faux s'il est inconnu
+    static bool parseConstruction(const std::string& name, Construction& construction);
+
+    // Nom de l'heuristique de construction
+    static const char* constructionName(Construction construction);
+
+    // Nombre de threads de la phase multi-départ (défaut : threads matériels)
+    void setThreadCount(int threads) { options_.threads = threads; }
+
+    // Nombre de nœuds de départ tirés au hasard
+    // (0 : tous les nœuds jusqu'à kAllStartsLimit nœuds, un échantillon au-delà)
+    void setStartSampleSize(int starts) { options_.startSampleSize = starts; }
+
+    // Nombre de meilleures tournées de départ améliorées en parallèle
+    void setTopK(int topK) { options_.topK = topK; }
+
+    // Graine du générateur pseudo-aléatoire (tirage des départs, perturbations)
+    void setSeed(unsigned seed) { options_.seed = seed; }
+
+    // Recherche locale itérée après la première optimisation locale : s'arrête après
+    // timeLimit secondes depuis l'appel de solve() et/ou iterations perturbations
+    // (0 : pas de limite de ce type ; sans aucune limite, la recherche itérée est désactivée).
+    // Avec plusieurs threads, chaque thread fait évoluer sa propre île (limite
+    // d'itérations par île) et les îles partagent leur meilleure tournée.
+    void setTimeLimit(double seconds) { options_.timeLimit = seconds; }
+    void setIterationLimit(long iterations) { options_.iterationLimit = iterations; }
+
+    // Longueur jugée suffisante (par exemple borne inférieure + écart visé) : la recherche
+    // itérée s'arrête dès qu'une tournée l'atteint. Seule, elle active la recherche itérée
+    // avec une limite de 20 perturbations par nœud. 0 : pas de cible.
+    void setTargetLength(long length) { options_.targetLength = length; }
+
+    // Jusqu'à cette dimension, solve() résout exactement : programmation dynamique
+    // jusqu'à 18 nœuds, séparation et évaluation à partir de la tournée heuristique
+    // au-delà (64 nœuds au plus). 0 : heuristiques seules.
+    void setExactLimit(int nodes) { options_.exactLimit = nodes; }
+
+    // Au-delà de cette dimension, les instances à coordonnées sont découpées en grappes
+    // d'au plus nodes nœuds résolues en parallèle, puis assemblées et réparées
+    // (Decomposition). 0 (défaut) : résolution directe.
+    void setClusterSize(int nodes) { options_.clusterSize = nodes; }
+
+    // Rappel à chaque amélioration : première tournée construite, tournées améliorées,
+    // records de la recherche itérée (longueurs strictement décroissantes)
+    void setImprovementCallback(const ImprovementCallback& callback) { options_.onImprovement = callback; }
+
+    // Jeton d'annulation consulté dans les boucles de recherche : solve() retourne alors
+    // au plus vite la meilleure tournée trouvée (une tournée valide dans tous les cas)
+    void setCancellation(const CancellationToken* token) { options_.cancellation = token; }
+
+    // Départ à chaud (WarmStart) : order remplace les tournées de départ, et seuls les
+    // nœuds changedNodes sont actifs lors de la première amélioration locale.
+    // Un ordre vide (défaut) rétablit la construction habituelle.
+    void setWarmStart(const std::vector<int>& order, const std::vector<int>& changedNodes) {
+        warmStart_ = order;
+        warmStartChanged_ = changedNodes;
+    }
 
     // Méthode principale pour lancer la résolution du TSP
     // Retourne un objet Tour représentant la solution trouvée
     Tour solve() const;
 
+    // Vrai si la tournée retournée par le dernier appel à solve() est prouvée optimale
+    bool isProvenOptimal() const { return provenOptimal_; }
+
+    // Phases de solve(), utilisables séparément (mesures de performance, tsp_bench)
+
+    // Tournées de départ : avec le plus proche voisin, les topK meilleures du multi-départ,
+    // de la plus courte à la plus longue ; sinon l'unique tournée de l'heuristique choisie
+    std::vector<Tour> constructStartTours() const;
+
+    // L'algorithme remplace des paires d'arêtes pour réduire la distance totale de la tournée
+    Tour OptimizationSwapEdges(const Tour& tour) const;
+
+    // 2-opt exhaustif en meilleure amélioration, sans listes de candidats : balayages
+    // complets de la tournée (BestImprovementTwoOpt), répartis entre les threads
+    Tour OptimizationBestTwoOpt(const Tour& tour) const;
+
+    // Déplace des segments de 1 à 3 nœuds (Or-opt) et échange des segments
+    // consécutifs (3-opt restreint), en plus du 2-opt, jusqu'à un optimum local commun
+    Tour OptimizationMoveSegments(const Tour& tour) const;
+
+    // Recherche à profondeur variable : suites d'au plus 5 mouvements 2-opt
+    // sur une liste doublement chaînée à deux niveaux
+    Tour OptimizationLinKernighan(const Tour& tour) const;
+
 private:
     const Graph& graph_; // Référence constante au graphe
+    Options options_;
+    std::vector<int> warmStart_;        // Tournée de départ fournie (vide : aucune)
+    std::vector<int> warmStartChanged_; // Nœuds à réoptimiser dans warmStart_
+    mutable bool provenOptimal_ = false; // Résultat du dernier solve()
+    mutable std::mutex reportMutex_;     // Sérialise les appels de options_.onImprovement
+    mutable long reportedLength_ = 0;    // Dernière longueur signalée (0 : aucune)
+
+    // Nombre de threads effectif
+    int threadCount() const;
+
+    // Vrai si l'annulation a été demandée
+    bool isCancelled() const { return CancellationToken::isCancelled(options_.cancellation); }
+
+    // Signale tour au rappel d'amélioration si elle est plus courte que la précédente
+    void reportImprovement(const Tour& tour) const;
+
+    // Multi-départ, amélioration locale et recherche itérée
+    Tour solveHeuristic() const;
+
+    // Décomposition géométrique (options_.clusterSize)
+    Tour solveDecomposed() const;
+
+    // Nœuds de départ de la phase multi-départ
+    std::vector<int> chooseStartNodes() const;
+
+    // Applique le moteur d'amélioration choisi à une tournée de départ
+    Tour improveTour(const Tour& tour) const;
+
+    // Amélioration de la tournée de départ fournie, limitée au voisinage des changements
+    Tour improveWarmStart() const;
 
     // Implémentation de l'algorithme du plus proche voisin
     Tour nearestNeighborSolve(int start_node) const;
 
-    // L'algorithme remplace des paires d'arêtes pour réduire la distance totale de la tournée
-    Tour OptimizationSwapEdges(const Tour& tour) const;
+    // Plus proche voisin géométrique à l'aide d'une grille uniforme dont on retire
+    // les nœuds visités : environ O(N log N), sans consulter la matrice de distances
+    Tour nearestNeighborGridSolve(int start_node) const;
+
+    // Recherche locale itérée : doubles ponts locaux (échange de deux segments courts
+    // consécutifs), réoptimisation autour des extrémités seulement, annulation du
+    // coup si la tournée s'allonge. Retourne la meilleure tournée trouvée.
+    // Avec shared, l'île publie ses records et reprend la meilleure tournée commune
+    // lorsqu'elle stagne.
+    Tour iteratedLocalSearch(const Tour& tour, std::chrono::steady_clock::time_point deadline,
+                             long iterations, unsigned seed, SharedBestTour* shared) const;
 
     // Empêcher la copie et l'assignation (le solver est lié à un graphe spécifique) pour le moment
     TspSolver(const TspSolver&) = delete;
     TspSolver& operator=(const TspSolver&) = delete;
 };
 
+// Nom de l'API de la bibliothèque
+using SolverOptions = TspSolver::Options;
+
 #endif
\ No newline at end of file
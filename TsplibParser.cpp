@@ -1,267 +1,500 @@
 #include "TsplibParser.h"
-#include <sstream> // Pour utiliser istringstream
+#include <algorithm> // Pour std::min, std::max
+#include <cstdint>   // Pour std::uint64_t
+#include <cstdlib>   // Pour std::strtod
+#include <limits>    // Pour std::numeric_limits
 
-// Constructeur
-TsplibParser::TsplibParser(const std::string& filename) : filename_(filename) {
-    // Le constructeur initialise simplement le nom du fichier.
+#include "MappedFile.h"
+#include "Parallel.h"
+#include "Stats.h"
+
+namespace {
+
+// Puissances de dix exactement représentables en double
+const double kPowersOfTen[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+inline bool isSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
 }
 
-// Méthode principale pour parser le fichier
-bool TsplibParser::parse() {
-    std::ifstream file(filename_);
-    if (!file.is_open()) {
-        std::cerr << "Erreur: Impossible d'ouvrir le fichier " << filename_ << std::endl;
-        return false;
+inline bool isDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+// Vrai si pos est en fin de jeton (espace ou fin du fichier)
+inline bool atTokenEnd(const char* pos, const char* end) {
+    return pos == end || isSpace(*pos);
+}
+
+// Saute les blancs, fins de ligne comprises
+inline void skipWhitespace(const char*& pos, const char* end) {
+    while (pos < end && isSpace(*pos)) {
+        ++pos;
     }
+}
 
-    // 1. Lire l'en-tête
-    if (!parseHeader(file)) {
-        file.close();
-        return false;
+// Avance jusqu'au début de la ligne suivante
+inline void skipLine(const char*& pos, const char* end) {
+    while (pos < end && *pos != '\n') {
+        ++pos;
+    }
+    if (pos < end) {
+        ++pos;
     }
+}
 
-    // Vérifier la dimension
-    if (dimension_ <= 0) {
-        std::cerr << "Erreur de parsing: Dimension non valide ou introuvable." << std::endl;
-        file.close();
-        return false;
+// Lit un mot-clé (jusqu'à un blanc ou ':') après avoir sauté les blancs
+std::string readKeyword(const char*& pos, const char* end) {
+    skipWhitespace(pos, end);
+    const char* start = pos;
+    while (pos < end && !isSpace(*pos) && *pos != ':') {
+        ++pos;
     }
+    return std::string(start, pos);
+}
 
-    // 2. Parser les sections en fonction du type de poids des arêtes
-    if (edgeWeightType_ == "EXPLICIT") {
-        if (!parseEdgeWeightSection(file)) {
-            file.close();
-            return false;
+// Lit la valeur d'une ligne d'en-tête (après un ':' facultatif), sans blancs autour
+std::string readHeaderValue(const char*& pos, const char* end) {
+    while (pos < end && (*pos == ' ' || *pos == '\t')) {
+        ++pos;
+    }
+    if (pos < end && *pos == ':') {
+        ++pos;
+    }
+    const char* start = pos;
+    skipLine(pos, end);
+    const char* stop = pos;
+    while (stop > start && isSpace(stop[-1])) {
+        --stop;
+    }
+    while (start < stop && isSpace(*start)) {
+        ++start;
+    }
+    return std::string(start, stop);
+}
+
+// Vrai si le mot-clé introduit une section de données
+inline bool isSectionKeyword(const std::string& keyword) {
+    const std::string suffix = "_SECTION";
+    return keyword.size() >= suffix.size() &&
+           keyword.compare(keyword.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+// Saute les lignes de données d'une section non utilisée (jusqu'au prochain mot-clé)
+void skipSection(const char*& pos, const char* end) {
+    while (true) {
+        skipWhitespace(pos, end);
+        if (pos == end || !(isDigit(*pos) || *pos == '-' || *pos == '+' || *pos == '.')) {
+            return;
         }
-    } else if (edgeWeightType_ == "EUC_2D" || edgeWeightType_ == "ATT") {
-        if (!parseNodeCoordSection(file)) {
-            file.close();
+        skipLine(pos, end);
+    }
+}
+
+// Lit un entier signé ; faux si le jeton n'est pas un entier représentable en int
+bool parseInt(const char*& pos, const char* end, int& value) {
+    const char* p = pos;
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        ++p;
+    }
+    if (p == end || !isDigit(*p)) {
+        return false;
+    }
+    long long result = 0;
+    while (p < end && isDigit(*p)) {
+        result = result * 10 + (*p - '0');
+        if (result > std::numeric_limits<int>::max()) {
             return false;
         }
-        computeDistanceMatrixFromCoords();
-    } else {
-        std::cerr << "Erreur de parsing: Type de poids des arêtes non supporté : " << edgeWeightType_ << std::endl;
-        std::cerr << "Types supportés: EXPLICIT, EUC_2D, ATT." << std::endl;
-        file.close();
+        ++p;
+    }
+    if (!atTokenEnd(p, end)) {
         return false;
     }
+    value = static_cast<int>(negative ? -result : result);
+    pos = p;
+    return true;
+}
 
-    // Recherche de la fin du fichier
-    std::string line;
-    while (std::getline(file, line)) {
-        if (line == "EOF") {
-            break;
-        }
+// Lit un réel (notation décimale ou scientifique).
+// Chemin rapide de Clinger : si la mantisse tient exactement dans un double (< 2^53)
+// et que |exposant| <= 22, une seule multiplication ou division IEEE donne le
+// résultat correctement arrondi. Sinon on se replie sur std::strtod.
+bool parseDouble(const char*& pos, const char* end, double& value) {
+    const char* start = pos;
+    const char* p = pos;
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        ++p;
     }
 
+    std::uint64_t mantissa = 0;
+    int significant = 0; // Chiffres significatifs accumulés dans la mantisse
+    int exponent = 0;
+    bool has_digit = false;
+    bool exact = true;
+
+    auto add_digit = [&](char c) {
+        has_digit = true;
+        if (significant < 19) {
+            mantissa = mantissa * 10 + static_cast<std::uint64_t>(c - '0');
+            if (mantissa != 0) {
+                ++significant;
+            }
+            return true;
+        }
+        exact = false; // Trop de chiffres : le repli se chargera de l'arrondi
+        return false;
+    };
 
-    file.close();
-    return true;
-}
-
-// Cherche et lit une ligne commençant par un mot-clé spécifié
-bool TsplibParser::readLineWithKeyword(std::ifstream& file, const std::string& keyword, std::string& value) {
-    file.clear(); // Effacer les flags d'erreur précédents
-    file.seekg(0); // Revenir au début du fichier pour la recherche
-
-    std::string line;
-    while (std::getline(file, line)) {
-        // Supprimer les espaces en début et fin de ligne
-        size_t first_char = line.find_first_not_of(" \t");
-        if (first_char == std::string::npos) continue; // Ligne vide ou ne contenant que des espaces
-
-        if (line.substr(first_char, keyword.length()) == keyword) {
-            // Le mot-clé est trouvé extraire la valeur après le ':' ou les espaces
-            size_t separator_pos = line.find(':');
-            if (separator_pos != std::string::npos) {
-                value = line.substr(separator_pos + 1);
-            } else {
-                 // Si pas de ':', prendre tout ce qui suit le mot-clé et les espaces
-                 separator_pos = line.find_first_not_of(" \t", first_char + keyword.length());
-                 if (separator_pos != std::string::npos) {
-                     value = line.substr(separator_pos);
-                 } else {
-                     value = "";
-                 }
+    while (p < end && isDigit(*p)) {
+        if (!add_digit(*p)) {
+            ++exponent;
+        }
+        ++p;
+    }
+    if (p < end && *p == '.') {
+        ++p;
+        while (p < end && isDigit(*p)) {
+            if (add_digit(*p)) {
+                --exponent;
             }
-            // Supprimer les espaces en début et fin de la valeur extraite
-            size_t val_first_char = value.find_first_not_of(" \t");
-            size_t val_last_char = value.find_last_not_of(" \t");
-            if (val_first_char != std::string::npos) {
-                value = value.substr(val_first_char, val_last_char - val_first_char + 1);
-            } else {
-                value = "";
+            ++p;
+        }
+    }
+    if (!has_digit) {
+        return false;
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        ++p;
+        bool negative_exponent = false;
+        if (p < end && (*p == '-' || *p == '+')) {
+            negative_exponent = (*p == '-');
+            ++p;
+        }
+        if (p == end || !isDigit(*p)) {
+            return false;
+        }
+        int written = 0;
+        while (p < end && isDigit(*p)) {
+            if (written < 100000) {
+                written = written * 10 + (*p - '0');
             }
-
-            return true;
+            ++p;
         }
+        exponent += negative_exponent ? -written : written;
+    }
+    if (!atTokenEnd(p, end)) {
+        return false;
     }
-    return false;
+
+    if (exact && mantissa <= (std::uint64_t(1) << 53) && exponent >= -22 && exponent <= 22) {
+        double result = static_cast<double>(mantissa);
+        result = exponent < 0 ? result / kPowersOfTen[-exponent] : result * kPowersOfTen[exponent];
+        value = negative ? -result : result;
+    } else {
+        // Le fichier projeté n'est pas terminé par '\0' : copier le jeton
+        std::string token(start, p);
+        value = std::strtod(token.c_str(), nullptr);
+    }
+    pos = p;
+    return true;
 }
 
+} // namespace
 
-// Parse les informations d'en-tête du fichier
-bool TsplibParser::parseHeader(std::ifstream& file) {
-    std::string value;
+// Constructeur
+TsplibParser::TsplibParser(const std::string& filename) : filename_(filename) {
+    // Le constructeur initialise simplement le nom du fichier.
+}
 
-    // Lire la dimension
-    if (!readLineWithKeyword(file, "DIMENSION", value)) {
-        std::cerr << "Erreur de parsing: Mot-clé DIMENSION non trouvé." << std::endl;
+// Méthode principale pour parser le fichier
+// Le fichier est projeté en mémoire puis lu en une seule passe : en-tête, puis
+// sections dans l'ordre où elles apparaissent, jusqu'à EOF.
+bool TsplibParser::parse() {
+    TSP_STATS_TIMER(Parse);
+    MappedFile file;
+    if (!file.open(filename_)) {
+        std::cerr << "Erreur: Impossible d'ouvrir le fichier " << filename_ << std::endl;
         return false;
     }
-    try {
-        dimension_ = std::stoi(value);
-    } catch (const std::invalid_argument& ia) {
-        std::cerr << "Erreur de parsing: Valeur de DIMENSION invalide : " << value << std::endl;
+    const char* pos = file.data();
+    const char* end = pos + file.size();
+
+    // 1. Lire l'en-tête
+    std::string section;
+    if (!parseHeader(pos, end, section)) {
         return false;
-    } catch (const std::out_of_range& oor) {
-         std::cerr << "Erreur de parsing: Valeur de DIMENSION hors limites : " << value << std::endl;
-         return false;
     }
 
+    // 2. Parser les sections utiles au type de poids des arêtes, sauter les autres
+    const bool is_explicit = (edgeWeightType_ == "EXPLICIT");
+    bool data_found = false;
+    while (!section.empty()) {
+        if (!data_found && is_explicit && section == "EDGE_WEIGHT_SECTION") {
+            if (!parseEdgeWeightSection(pos, end)) {
+                return false;
+            }
+            data_found = true;
+        } else if (!data_found && !is_explicit && section == "NODE_COORD_SECTION") {
+            if (!parseNodeCoordSection(pos, end)) {
+                return false;
+            }
+            data_found = true;
+        } else {
+            skipSection(pos, end);
+        }
 
-    // Lire le type de poids des arêtes
-    if (!readLineWithKeyword(file, "EDGE_WEIGHT_TYPE", value)) {
-        std::cerr << "Erreur de parsing: Mot-clé EDGE_WEIGHT_TYPE non trouvé." << std::endl;
-        return false;
+        // Mot-clé suivant (les lignes d'en-tête tardives sont ignorées)
+        section.clear();
+        while (pos < end) {
+            std::string keyword = readKeyword(pos, end);
+            if (keyword == "EOF") {
+                break;
+            }
+            skipLine(pos, end);
+            if (isSectionKeyword(keyword)) {
+                section = keyword;
+                break;
+            }
+        }
     }
-    edgeWeightType_ = value;
-
 
+    if (!data_found) {
+        std::cerr << "Erreur de parsing: Section " << (is_explicit ? "EDGE_WEIGHT_SECTION" : "NODE_COORD_SECTION")
+                  << " non trouvée." << std::endl;
+        return false;
+    }
+    if (!is_explicit && !deferDistanceMatrix_) {
+        computeDistanceMatrixFromCoords();
+    }
     return true;
 }
 
-// Parse la section NODE_COORD_SECTION
-bool TsplibParser::parseNodeCoordSection(std::ifstream& file) {
-    file.clear(); // Effacer les flags d'erreur
-    file.seekg(0); // Revenir au début pour chercher la section
-
-    std::string line;
-    bool section_found = false;
-    while (std::getline(file, line)) {
-        if (line == "NODE_COORD_SECTION") {
-            section_found = true;
+// Lit la DIMENSION dans l'en-tête, sans parcourir les sections
+int TsplibParser::readDimension(const std::string& filename) {
+    MappedFile file;
+    if (!file.open(filename)) {
+        return 0;
+    }
+    const char* pos = file.data();
+    const char* end = pos + file.size();
+    while (pos < end) {
+        std::string keyword = readKeyword(pos, end);
+        if (keyword.empty() || keyword == "EOF" || isSectionKeyword(keyword)) {
             break;
         }
+        std::string value = readHeaderValue(pos, end);
+        if (keyword == "DIMENSION") {
+            const char* value_pos = value.data();
+            int dimension = 0;
+            return parseInt(value_pos, value_pos + value.size(), dimension) ? dimension : 0;
+        }
+    }
+    return 0;
+}
+
+// Parse les lignes d'en-tête jusqu'au premier mot-clé de section
+bool TsplibParser::parseHeader(const char*& pos, const char* end, std::string& section) {
+    bool dimension_found = false;
+    bool type_found = false;
+    dimension_ = 0;
+    edgeWeightType_.clear();
+    section.clear();
+
+    while (pos < end) {
+        std::string keyword = readKeyword(pos, end);
+        if (keyword.empty() && pos == end) {
+            break;
+        }
+        if (keyword == "EOF") {
+            break;
+        }
+        if (isSectionKeyword(keyword)) {
+            section = keyword;
+            skipLine(pos, end);
+            break;
+        }
+
+        std::string value = readHeaderValue(pos, end);
+        if (keyword == "DIMENSION") {
+            const char* value_pos = value.data();
+            if (!parseInt(value_pos, value_pos + value.size(), dimension_)) {
+                std::cerr << "Erreur de parsing: Valeur de DIMENSION invalide : " << value << std::endl;
+                return false;
+            }
+            dimension_found = true;
+        } else if (keyword == "EDGE_WEIGHT_TYPE") {
+            edgeWeightType_ = value;
+            type_found = true;
+        }
     }
 
-    if (!section_found) {
-        std::cerr << "Erreur de parsing: Section NODE_COORD_SECTION non trouvée." << std::endl;
+    if (!dimension_found) {
+        std::cerr << "Erreur de parsing: Mot-clé DIMENSION non trouvé." << std::endl;
+        return false;
+    }
+    if (!type_found) {
+        std::cerr << "Erreur de parsing: Mot-clé EDGE_WEIGHT_TYPE non trouvé." << std::endl;
         return false;
     }
 
-    // Lire les coordonnées des nœuds
+    // Vérifier la dimension
+    if (dimension_ <= 0) {
+        std::cerr << "Erreur de parsing: Dimension non valide ou introuvable." << std::endl;
+        return false;
+    }
+
+    if (edgeWeightType_ != "EXPLICIT" && edgeWeightType_ != "EUC_2D" && edgeWeightType_ != "ATT") {
+        std::cerr << "Erreur de parsing: Type de poids des arêtes non supporté : " << edgeWeightType_ << std::endl;
+        std::cerr << "Types supportés: EXPLICIT, EUC_2D, ATT." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Parse la section NODE_COORD_SECTION
+// Chaque ligne contient « id x y » ; les coordonnées sont rangées dans l'ordre du fichier.
+bool TsplibParser::parseNodeCoordSection(const char*& pos, const char* end) {
     nodeCoords_.resize(dimension_); // Allouer de l'espace pour les coordonnées
     for (int i = 0; i < dimension_; ++i) {
-        if (!std::getline(file, line)) {
+        skipWhitespace(pos, end);
+        if (pos == end) {
             std::cerr << "Erreur de parsing: Fin de fichier inattendue lors de la lecture des coordonnées du nœud " << i + 1 << std::endl;
             return false;
         }
-        std::stringstream ss(line);
+        const char* line = pos;
         int node_id;
-        // Les IDs des nœuds dans le fichier commencent à 1, notre vecteur à 0
-        if (!(ss >> node_id >> nodeCoords_[i].x >> nodeCoords_[i].y)) {
-             std::cerr << "Erreur de parsing: Format de ligne invalide pour les coordonnées du nœud " << i + 1 << ": " << line << std::endl;
-             return false;
+        bool ok = parseInt(pos, end, node_id);
+        if (ok) {
+            skipWhitespace(pos, end);
+            ok = parseDouble(pos, end, nodeCoords_[i].x);
+        }
+        if (ok) {
+            skipWhitespace(pos, end);
+            ok = parseDouble(pos, end, nodeCoords_[i].y);
+        }
+        if (!ok) {
+            const char* line_end = line;
+            while (line_end < end && *line_end != '\n' && *line_end != '\r') {
+                ++line_end;
+            }
+            std::cerr << "Erreur de parsing: Format de ligne invalide pour les coordonnées du nœud " << i + 1
+                      << ": " << std::string(line, line_end) << std::endl;
+            return false;
         }
+        skipLine(pos, end);
     }
-
     return true;
 }
 
 // Parse la section EDGE_WEIGHT_SECTION (format UPPER_ROW)
-bool TsplibParser::parseEdgeWeightSection(std::ifstream& file) {
-    file.clear(); // Effacer les flags d'erreur
-    file.seekg(0); // Revenir au début pour chercher la section
-
-    std::string line;
-    bool section_found = false;
-    while (std::getline(file, line)) {
-        if (line == "EDGE_WEIGHT_SECTION") {
-            section_found = true;
-            break;
-        }
-    }
-
-    if (!section_found) {
-        std::cerr << "Erreur de parsing: Section EDGE_WEIGHT_SECTION non trouvée." << std::endl;
-        return false;
-    }
-
-    // Initialiser la matrice de distances
-    distanceMatrix_.resize(dimension_, std::vector<int>(dimension_));
+bool TsplibParser::parseEdgeWeightSection(const char*& pos, const char* end) {
+    // Initialiser la matrice de distances (diagonale à 0)
+    distanceMatrix_.assign(matrixStorageSize(dimension_, matrixLayout_), 0);
 
     // Lire les distances (format UPPER_ROW)
     // Le format UPPER_ROW liste les distances du triangle supérieur de la matrice
     // ligne par ligne. Pour une matrice N x N, la ligne i (0-indexée) contient
     // les distances entre le nœud i et les nœuds i+1, i+2, ..., N-1.
     // Nombre total de distances = N * (N - 1) / 2
-
-    std::stringstream ss;
-    std::string current_line;
-    int value;
-    int count = 0; // Compteur pour suivre le nombre de distances lues
-
-    // Remplir la matrice
+    // Chaque ligne i est écrite de façon contiguë ; en disposition Full, le triangle
+    // inférieur est recopié ensuite par tuiles plutôt que colonne par colonne.
     for (int i = 0; i < dimension_; ++i) {
-        distanceMatrix_[i][i] = 0; // Distance d'un nœud à lui-même est 0
+        int* row = &distanceMatrix_[matrixIndex(i, i, dimension_, matrixLayout_)];
         for (int j = i + 1; j < dimension_; ++j) {
-            // Lire la prochaine valeur disponible
-            while (!(ss >> value)) {
-                if (!std::getline(file, current_line)) {
-                    std::cerr << "Erreur de parsing: Fin de fichier inattendue ou format incorrect dans EDGE_WEIGHT_SECTION." << std::endl;
-                    return false;
-                }
-                ss.clear(); // Effacer les flags d'erreur du stringstream
-                ss.str(current_line); // Charger la nouvelle ligne dans le stringstream
+            skipWhitespace(pos, end);
+            if (pos == end) {
+                std::cerr << "Erreur de parsing: Fin de fichier inattendue ou format incorrect dans EDGE_WEIGHT_SECTION." << std::endl;
+                return false;
+            }
+            if (!parseInt(pos, end, row[j - i])) {
+                std::cerr << "Erreur de parsing: Valeur invalide dans EDGE_WEIGHT_SECTION (ligne " << i + 1
+                          << ", colonne " << j + 1 << ")." << std::endl;
+                return false;
             }
-            // Stocker la distance (la matrice est symétrique)
-            distanceMatrix_[i][j] = value;
-            distanceMatrix_[j][i] = value;
-            count++;
         }
     }
 
+    if (matrixLayout_ == MatrixLayout::Full) {
+        mirrorUpperTriangle();
+    }
     return true;
 }
 
-// Calcule la distance pour EDGE_WEIGHT_TYPE = ATT
-int TsplibParser::calculateAttDistance(const Point& p1, const Point& p2) const {
-    double dx = p1.x - p2.x;
-    double dy = p1.y - p2.y;
-    double dist = std::sqrt((dx * dx + dy * dy) / 10.0); // documentation page 6&7
-    return static_cast<int>(std::round(dist));
+// Construit la matrice de distances à partir des coordonnées
+bool TsplibParser::buildDistanceMatrix() {
+    if (!hasCoordinates() || nodeCoords_.empty()) {
+        std::cerr << "Erreur: Aucune coordonnée disponible pour construire la matrice de distances." << std::endl;
+        return false;
+    }
+    computeDistanceMatrixFromCoords();
+    return true;
 }
 
-// Calcule la distance euclidienne 2D (arrondie)
-int TsplibParser::calculateEuclideanDistance(const Point& p1, const Point& p2) const {
-    double dx = p1.x - p2.x;
-    double dy = p1.y - p2.y;
-    double dist = std::sqrt(dx * dx + dy * dy);
-    return static_cast<int>(std::round(dist));
+// Recopie le triangle supérieur dans le triangle inférieur (disposition Full)
+// Parcours par tuiles pour que lectures et écritures restent dans le cache.
+void TsplibParser::mirrorUpperTriangle() {
+    const int tile = 64;
+    const int n = dimension_;
+    int tiles = (n + tile - 1) / tile;
+    int threads = threadCount_ > 0 ? threadCount_ : hardwareThreads();
+    parallelFor(tiles, threads, [&](int index, int) {
+        int row_begin = index * tile;
+        int row_end = std::min(n, row_begin + tile);
+        for (int column_begin = row_begin; column_begin < n; column_begin += tile) {
+            int column_end = std::min(n, column_begin + tile);
+            for (int i = row_begin; i < row_end; ++i) {
+                const int* source = &distanceMatrix_[static_cast<std::size_t>(i) * n];
+                for (int j = std::max(column_begin, i + 1); j < column_end; ++j) {
+                    distanceMatrix_[static_cast<std::size_t>(j) * n + i] = source[j];
+                }
+            }
+        }
+    });
 }
 
-
 // Calcule la matrice des distances à partir des coordonnées
 void TsplibParser::computeDistanceMatrixFromCoords() {
+    TSP_STATS_TIMER(Matrix);
     if (nodeCoords_.empty() || dimension_ <= 0) {
         std::cerr << "Erreur: Coordonnées des nœuds non disponibles ou dimension invalide pour calculer la matrice de distances." << std::endl;
         return;
     }
 
-    distanceMatrix_.resize(dimension_, std::vector<int>(dimension_));
+    distanceMatrix_.assign(matrixStorageSize(dimension_, matrixLayout_), 0);
 
+    // Coordonnées en tableaux séparés (SoA) pour le noyau vectoriel
+    std::vector<double> xs(dimension_), ys(dimension_);
     for (int i = 0; i < dimension_; ++i) {
-        distanceMatrix_[i][i] = 0;
-        for (int j = i + 1; j < dimension_; ++j) {
-            int distance;
-            if (edgeWeightType_ == "EUC_2D") {
-                distance = calculateEuclideanDistance(nodeCoords_[i], nodeCoords_[j]);
-            } else if (edgeWeightType_ == "ATT") {
-                distance = calculateAttDistance(nodeCoords_[i], nodeCoords_[j]);
-            distanceMatrix_[i][j] = distance;
-            distanceMatrix_[j][i] = distance;
+        xs[i] = nodeCoords_[i].x;
+        ys[i] = nodeCoords_[i].y;
+    }
+    const CoordMetric metric = getCoordMetric();
+
+    // Chaque ligne est écrite d'un seul tenant ; les blocs de lignes sont répartis
+    // entre les threads. Une ligne complète coûte deux fois plus de calculs que la
+    // moitié symétrique, mais évite les écritures dispersées en colonne.
+    const int block = 64;
+    int blocks = (dimension_ + block - 1) / block;
+    int threads = threadCount_ > 0 ? threadCount_ : hardwareThreads();
+    parallelFor(blocks, threads, [&](int index, int) {
+        int end = std::min(dimension_, (index + 1) * block);
+        for (int i = index * block; i < end; ++i) {
+            if (matrixLayout_ == MatrixLayout::Full) {
+                int* row = &distanceMatrix_[matrixIndex(i, 0, dimension_, MatrixLayout::Full)];
+                computeDistances(xs.data(), ys.data(), dimension_, xs[i], ys[i], metric, row);
+            } else {
+                // Triangle supérieur : colonnes i..N-1 de la ligne i
+                int* row = &distanceMatrix_[matrixIndex(i, i, dimension_, MatrixLayout::UpperTriangle)];
+                computeDistances(xs.data() + i, ys.data() + i, dimension_ - i, xs[i], ys[i], metric, row);
             }
         }
-    }
+    });
 }
\ No newline at end of file
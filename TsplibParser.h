@@ -2,57 +2,81 @@
 #define TSPLIB_PARSER_H
 
 #include <iostream>
-#include <fstream>
 #include <string>
 #include <vector>
-#include <map>
-#include <cmath> // Pour sqrt et round
+#include <utility> // Pour std::move
 
-// Structure pour stocker les coordonnées d'un nœud
-struct Point {
-    double x;
-    double y;
-};
+#include "MatrixLayout.h"
+#include "Geometry.h" // Point et fonctions de distance
 
 class TsplibParser {
 public:
     // Constructeur prenant le nom du fichier TSPLIB
     TsplibParser(const std::string& filename);
 
+    // Choisit la disposition de la matrice produite (à appeler avant parse())
+    void setMatrixLayout(MatrixLayout layout) { matrixLayout_ = layout; }
+
+    // Nombre de threads utilisés pour construire la matrice (défaut : threads matériels)
+    void setThreadCount(int threads) { threadCount_ = threads; }
+
+    // Pour les instances à coordonnées, ne pas construire la matrice pendant parse()
+    // (elle pourra être construite plus tard avec buildDistanceMatrix(), ou pas du tout)
+    void setDeferDistanceMatrix(bool defer) { deferDistanceMatrix_ = defer; }
+
     // Méthode pour lancer le parsing du fichier
     bool parse();
 
+    // Lit seulement l'en-tête du fichier et retourne sa DIMENSION (0 si introuvable) ;
+    // sert à ordonner un lot d'instances avant de les parser
+    static int readDimension(const std::string& filename);
+
+    // Construit la matrice de distances à partir des coordonnées (EUC_2D, ATT)
+    bool buildDistanceMatrix();
+
+    // Vrai si l'instance est définie par des coordonnées (EUC_2D, ATT)
+    bool hasCoordinates() const { return edgeWeightType_ == "EUC_2D" || edgeWeightType_ == "ATT"; }
+
     // Getters pour accéder aux données parsées
     int getDimension() const { return dimension_; }
     std::string getEdgeWeightType() const { return edgeWeightType_; }
+    CoordMetric getCoordMetric() const { return edgeWeightType_ == "ATT" ? CoordMetric::Att : CoordMetric::Euc2d; }
     const std::vector<Point>& getNodeCoords() const { return nodeCoords_; }
-    const std::vector<std::vector<int>>& getDistanceMatrix() const { return distanceMatrix_; }
+    MatrixLayout getMatrixLayout() const { return matrixLayout_; }
+    const std::vector<int>& getDistanceMatrix() const { return distanceMatrix_; }
+
+    // Cède la matrice de distances à l'appelant (le parser ne la conserve pas)
+    std::vector<int> takeDistanceMatrix() { return std::move(distanceMatrix_); }
+
+    // Cède les coordonnées des nœuds à l'appelant
+    std::vector<Point> takeNodeCoords() { return std::move(nodeCoords_); }
 
 private:
     std::string filename_;
     int dimension_ = 0;
     std::string edgeWeightType_;
     std::vector<Point> nodeCoords_;
-    std::vector<std::vector<int>> distanceMatrix_;
+    MatrixLayout matrixLayout_ = MatrixLayout::Full;
+    bool deferDistanceMatrix_ = false;
+    int threadCount_ = 0; // 0 : threads matériels
+    std::vector<int> distanceMatrix_; // Tampon plat, disposition matrixLayout_
 
-    // Méthodes privées pour le parsing 
-    // Cherche et lit une ligne commençant par un mot-clé spécifié
-    bool readLineWithKeyword(std::ifstream& file, const std::string& keyword, std::string& value);
+    // Recopie le triangle supérieur dans le triangle inférieur (disposition Full)
+    void mirrorUpperTriangle();
 
-    // Parse les informations d'en-tête du fichier
-    bool parseHeader(std::ifstream& file);
+    // Méthodes privées pour le parsing
+    // Le fichier est projeté en mémoire et parcouru une seule fois : chaque méthode
+    // avance le curseur pos jusqu'à end.
+
+    // Parse les lignes d'en-tête jusqu'au premier mot-clé de section (section reçoit
+    // ce mot-clé, ou une chaîne vide si le fichier se termine avant)
+    bool parseHeader(const char*& pos, const char* end, std::string& section);
 
     // Parse la section NODE_COORD_SECTION
-    bool parseNodeCoordSection(std::ifstream& file);
+    bool parseNodeCoordSection(const char*& pos, const char* end);
 
     // Parse la section EDGE_WEIGHT_SECTION (format UPPER_ROW)
-    bool parseEdgeWeightSection(std::ifstream& file);
-
-    // Calcule la distance pour EDGE_WEIGHT_TYPE = ATT
-    int calculateAttDistance(const Point& p1, const Point& p2) const;
-
-    // Calcule la distance euclidienne 2D (arrondie)
-    int calculateEuclideanDistance(const Point& p1, const Point& p2) const;
+    bool parseEdgeWeightSection(const char*& pos, const char* end);
 
     // Calcule la matrice des distances à partir des coordonnées
     void computeDistanceMatrixFromCoords();
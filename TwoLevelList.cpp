@@ -0,0 +1,216 @@
+#include "TwoLevelList.h"
+#include <algorithm> // Pour std::reverse, std::swap, std::max
+#include <cmath>     // Pour std::sqrt
+
+// Constructeur
+TwoLevelList::TwoLevelList(const std::vector<int>& nodes)
+    : segmentOf_(nodes.size(), 0), indexOf_(nodes.size(), 0) {
+    groupSize_ = std::max(8, static_cast<int>(std::sqrt(static_cast<double>(nodes.size()))));
+    rebuild(nodes);
+}
+
+// Répartit la séquence en segments de groupSize_ nœuds (les vecteurs des segments
+// existants sont réutilisés : pas d'allocation aux reconstructions suivantes)
+void TwoLevelList::rebuild(const std::vector<int>& nodes) {
+    int n = static_cast<int>(nodes.size());
+    int count = (n + groupSize_ - 1) / groupSize_;
+    segments_.resize(count);
+    order_.resize(count);
+    rank_.resize(count);
+    for (int id = 0; id < count; ++id) {
+        int start = id * groupSize_;
+        int end = std::min(n, start + groupSize_);
+        segments_[id].nodes.assign(nodes.begin() + start, nodes.begin() + end);
+        segments_[id].reversed = false;
+        for (int i = start; i < end; ++i) {
+            segmentOf_[nodes[i]] = id;
+            indexOf_[nodes[i]] = i - start;
+        }
+        order_[id] = id;
+        rank_[id] = id;
+    }
+}
+
+// Successeur d'un nœud
+int TwoLevelList::next(int node) const {
+    int segmentId = segmentOf_[node];
+    int k = orientedIndex(node) + 1;
+    if (k < static_cast<int>(segments_[segmentId].nodes.size())) {
+        return nodeAt(segmentId, k);
+    }
+    int r = rank_[segmentId] + 1;
+    return nodeAt(order_[r == static_cast<int>(order_.size()) ? 0 : r], 0);
+}
+
+// Prédécesseur d'un nœud
+int TwoLevelList::prev(int node) const {
+    int segmentId = segmentOf_[node];
+    int k = orientedIndex(node);
+    if (k > 0) {
+        return nodeAt(segmentId, k - 1);
+    }
+    int r = rank_[segmentId] == 0 ? static_cast<int>(order_.size()) - 1 : rank_[segmentId] - 1;
+    int previous = order_[r];
+    return nodeAt(previous, static_cast<int>(segments_[previous].nodes.size()) - 1);
+}
+
+// Vrai si b se trouve sur le chemin a -> c
+bool TwoLevelList::between(int a, int b, int c) const {
+    // Position globale : (rang du segment, rang dans le segment)
+    auto before = [this](int u, int v) {
+        int ru = rank_[segmentOf_[u]];
+        int rv = rank_[segmentOf_[v]];
+        return ru < rv || (ru == rv && orientedIndex(u) <= orientedIndex(v));
+    };
+    if (before(a, c)) {
+        return before(a, b) && before(b, c);
+    }
+    return before(a, b) || before(b, c);
+}
+
+// Mouvement 2-opt : retire (a, b) et (c, d), ajoute (a, c) et (b, d)
+void TwoLevelList::flip(int a, int b, int c, int d) {
+    // Se ramener au sens où b suit a et d suit c
+    if (next(a) != b) {
+        std::swap(a, b);
+        std::swap(c, d);
+    }
+    reversePath(b, c);
+}
+
+// Coupe le segment du nœud pour que le nœud en devienne le premier
+void TwoLevelList::splitBefore(int node) {
+    int segmentId = segmentOf_[node];
+    int k = orientedIndex(node);
+    if (k == 0) {
+        return;
+    }
+
+    // Remettre le segment dans le sens de parcours (coût du même ordre que la coupe)
+    if (segments_[segmentId].reversed) {
+        std::vector<int>& nodes = segments_[segmentId].nodes;
+        std::reverse(nodes.begin(), nodes.end());
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            indexOf_[nodes[i]] = static_cast<int>(i);
+        }
+        segments_[segmentId].reversed = false;
+    }
+
+    // La seconde partie devient un nouveau segment, inséré juste après
+    int newId = static_cast<int>(segments_.size());
+    std::vector<int> tail(segments_[segmentId].nodes.begin() + k, segments_[segmentId].nodes.end());
+    segments_[segmentId].nodes.resize(k);
+    for (size_t i = 0; i < tail.size(); ++i) {
+        segmentOf_[tail[i]] = newId;
+        indexOf_[tail[i]] = static_cast<int>(i);
+    }
+    segments_.push_back(Segment{std::move(tail), false});
+
+    int r = rank_[segmentId] + 1;
+    order_.insert(order_.begin() + r, newId);
+    rank_.push_back(0);
+    for (size_t i = r; i < order_.size(); ++i) {
+        rank_[order_[i]] = static_cast<int>(i);
+    }
+}
+
+// Inverse l'ordre des segments de rangs from à to (circulaire, inclus)
+void TwoLevelList::reverseSegments(int from, int to) {
+    int count = static_cast<int>(order_.size());
+    int length = to - from;
+    if (length < 0) {
+        length += count;
+    }
+    length += 1;
+
+    int i = from, j = to;
+    for (int step = 0; step < length / 2; ++step) {
+        std::swap(order_[i], order_[j]);
+        i = (i + 1 == count) ? 0 : i + 1;
+        j = (j == 0) ? count - 1 : j - 1;
+    }
+    int r = from;
+    for (int step = 0; step < length; ++step) {
+        segments_[order_[r]].reversed = !segments_[order_[r]].reversed;
+        rank_[order_[r]] = r;
+        r = (r + 1 == count) ? 0 : r + 1;
+    }
+}
+
+// Inverse le chemin first -> last
+void TwoLevelList::reversePath(int first, int last) {
+    int segmentId = segmentOf_[first];
+    if (segmentId == segmentOf_[last]) {
+        int kf = orientedIndex(first);
+        int kl = orientedIndex(last);
+        if (kf > kl) {
+            // Le chemin fait le tour : inverser le complément, contenu dans ce segment
+            if (kl + 1 > kf - 1) {
+                return; // Le chemin couvre toute la tournée : rien ne change
+            }
+            std::swap(kf, kl);
+            ++kf;
+            --kl;
+        }
+        // Inversion sur place de la plage [kf, kl] du segment
+        Segment& segment = segments_[segmentId];
+        int size = static_cast<int>(segment.nodes.size());
+        int lo = segment.reversed ? size - 1 - kl : kf;
+        int hi = segment.reversed ? size - 1 - kf : kl;
+        std::reverse(segment.nodes.begin() + lo, segment.nodes.begin() + hi + 1);
+        for (int i = lo; i <= hi; ++i) {
+            indexOf_[segment.nodes[i]] = i;
+        }
+        return;
+    }
+
+    // Découper pour que le chemin soit formé de segments entiers
+    int after = next(last);
+    splitBefore(first);
+    if (after != first) {
+        splitBefore(after);
+    }
+
+    // Inverser le plus court des deux arcs de segments
+    int count = static_cast<int>(order_.size());
+    int from = rank_[segmentOf_[first]];
+    int to = rank_[segmentOf_[last]];
+    int length = to - from;
+    if (length < 0) {
+        length += count;
+    }
+    length += 1;
+    if (2 * length > count && length < count) {
+        reverseSegments(to + 1 == count ? 0 : to + 1, from == 0 ? count - 1 : from - 1);
+    } else {
+        reverseSegments(from, to);
+    }
+
+    // Les coupes multiplient les segments : reconstruire quand il y en a trop
+    int target = (size() + groupSize_ - 1) / groupSize_;
+    if (count > 2 * target + 8) {
+        rebuild(toVector(order_.empty() ? 0 : nodeAt(order_[0], 0)));
+    }
+}
+
+// Séquence des nœuds en partant de start : parcours des segments dans l'ordre, chacun
+// lu d'un bloc (accès contigus, sans passer par next())
+std::vector<int> TwoLevelList::toVector(int start) const {
+    std::vector<int> nodes;
+    nodes.reserve(size());
+    int first = segmentOf_[start];
+    int k = orientedIndex(start);
+    int count = static_cast<int>(order_.size());
+    for (int step = 0; step < count; ++step) {
+        int segmentId = order_[(rank_[first] + step) % count];
+        int length = static_cast<int>(segments_[segmentId].nodes.size());
+        for (int i = (step == 0 ? k : 0); i < length; ++i) {
+            nodes.push_back(nodeAt(segmentId, i));
+        }
+    }
+    // Début du segment de départ, avant start
+    for (int i = 0; i < k; ++i) {
+        nodes.push_back(nodeAt(first, i));
+    }
+    return nodes;
+}
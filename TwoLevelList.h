@@ -0,0 +1,72 @@
+#ifndef TWO_LEVEL_LIST_H
+#define TWO_LEVEL_LIST_H
+
+#include <vector>
+
+// Représentation de tournée en liste doublement chaînée à deux niveaux.
+// Les nœuds sont regroupés en segments d'environ sqrt(N) nœuds ; chaque segment
+// porte un bit d'inversion. Une inversion de chemin coûte O(sqrt(N)) au lieu de
+// O(N) : on découpe les segments aux extrémités, puis on inverse l'ordre des
+// segments concernés en basculant leur bit, sans toucher aux nœuds.
+class TwoLevelList {
+public:
+    // Construit la liste à partir d'une séquence de nœuds (0..N-1)
+    explicit TwoLevelList(const std::vector<int>& nodes);
+
+    int size() const { return static_cast<int>(segmentOf_.size()); }
+
+    // Successeur et prédécesseur d'un nœud dans le sens de parcours courant
+    int next(int node) const;
+    int prev(int node) const;
+
+    // Vrai si b se trouve sur le chemin a -> c (bornes incluses) dans le sens courant
+    bool between(int a, int b, int c) const;
+
+    // Mouvement 2-opt : retire (a, b) et (c, d), où b suit a et d suit c dans un même
+    // sens de parcours, et ajoute (a, c) et (b, d)
+    void flip(int a, int b, int c, int d);
+
+    // Séquence des nœuds en partant de start
+    std::vector<int> toVector(int start) const;
+
+private:
+    // Segment : nœuds stockés dans un vecteur, lus à l'envers si reversed
+    struct Segment {
+        std::vector<int> nodes;
+        bool reversed;
+    };
+
+    std::vector<Segment> segments_;
+    std::vector<int> order_;     // Identifiants des segments dans l'ordre de la tournée
+    std::vector<int> rank_;      // Rang de chaque segment dans order_
+    std::vector<int> segmentOf_; // Segment contenant chaque nœud
+    std::vector<int> indexOf_;   // Indice du nœud dans le vecteur de son segment
+    int groupSize_;              // Taille visée des segments à la reconstruction
+
+    // Rang du nœud dans son segment, dans le sens de parcours
+    int orientedIndex(int node) const {
+        const Segment& segment = segments_[segmentOf_[node]];
+        int index = indexOf_[node];
+        return segment.reversed ? static_cast<int>(segment.nodes.size()) - 1 - index : index;
+    }
+
+    // Nœud de rang k (dans le sens de parcours) du segment
+    int nodeAt(int segmentId, int k) const {
+        const Segment& segment = segments_[segmentId];
+        return segment.reversed ? segment.nodes[segment.nodes.size() - 1 - k] : segment.nodes[k];
+    }
+
+    // Répartit la séquence en segments de groupSize_ nœuds
+    void rebuild(const std::vector<int>& nodes);
+
+    // Coupe le segment du nœud pour que le nœud en devienne le premier
+    void splitBefore(int node);
+
+    // Inverse le chemin first -> last (sens courant)
+    void reversePath(int first, int last);
+
+    // Inverse l'ordre des segments de rangs from à to (circulaire, inclus)
+    void reverseSegments(int from, int to);
+};
+
+#endif
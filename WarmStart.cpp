@@ -0,0 +1,226 @@
+#include "WarmStart.h"
+#include "Stats.h"
+
+#include <algorithm> // Pour std::sort, std::lower_bound
+#include <fstream>
+#include <iostream>
+#include <limits>    // Pour std::numeric_limits
+#include <numeric>   // Pour std::iota
+#include <sstream>
+
+// Constructeur
+WarmStart::WarmStart(const Graph& graph) : graph_(graph) {}
+
+// Lit la séquence des numéros et, si présentes, les coordonnées des nœuds
+bool WarmStart::readTourFile(const std::string& filename, std::vector<int>& ids, std::vector<Point>& coords) {
+    std::ifstream infile(filename);
+    if (!infile.is_open()) {
+        std::cerr << "Erreur: Impossible d'ouvrir la tournée " << filename << std::endl;
+        return false;
+    }
+    ids.clear();
+    coords.clear();
+    // Section en cours : 0 en-tête, 1 nœuds (jusqu'au -1), 2 coordonnées
+    int section = 0;
+    std::string line;
+    while (std::getline(infile, line)) {
+        if (line.compare(0, 3, "EOF") == 0) {
+            break;
+        }
+        if (line.compare(0, 10, "TOUR_NODES") == 0 || line.compare(0, 12, "TOUR_SECTION") == 0) {
+            section = 1;
+            continue;
+        }
+        if (line.compare(0, 11, "TOUR_COORDS") == 0) {
+            section = 2;
+            continue;
+        }
+        std::istringstream iss(line);
+        if (section == 1) {
+            int id = 0;
+            while (iss >> id && id != -1) {
+                ids.push_back(id);
+            }
+            if (id == -1) {
+                section = 0;
+            }
+        } else if (section == 2) {
+            Point point;
+            if (iss >> point.x >> point.y) {
+                coords.push_back(point);
+            }
+        }
+    }
+    if (ids.empty()) {
+        std::cerr << "Erreur: Aucune tournée dans " << filename << std::endl;
+        return false;
+    }
+    if (!coords.empty() && coords.size() != ids.size()) {
+        std::cerr << "Avertissement: Coordonnées incomplètes dans " << filename
+                  << ", nœuds reconnus par leur numéro." << std::endl;
+        coords.clear();
+    }
+    return true;
+}
+
+// Nœud du graphe correspondant à chaque entrée du fichier (-1 : nœud disparu).
+// Un nœud du graphe n'est attribué qu'une fois (doublons de coordonnées compris).
+std::vector<int> WarmStart::matchNodes(const std::vector<int>& ids, const std::vector<Point>& coords) const {
+    int dimension = graph_.getDimension();
+    const std::vector<Point>& points = graph_.getNodeCoords();
+    std::vector<int> matched(ids.size(), -1);
+    std::vector<char> used(dimension, 0);
+
+    if (coords.empty() || points.empty()) {
+        for (size_t i = 0; i < ids.size(); ++i) {
+            int node = ids[i] - 1;
+            if (node >= 0 && node < dimension && !used[node]) {
+                used[node] = 1;
+                matched[i] = node;
+            }
+        }
+        return matched;
+    }
+
+    // Nœuds du graphe triés par (x, y) : recherche dichotomique de chaque point
+    auto less = [&](int a, const Point& p) {
+        return points[a].x < p.x || (points[a].x == p.x && points[a].y < p.y);
+    };
+    std::vector<int> sorted(dimension);
+    std::iota(sorted.begin(), sorted.end(), 0);
+    std::sort(sorted.begin(), sorted.end(), [&](int a, int b) { return less(a, points[b]); });
+    for (size_t i = 0; i < ids.size(); ++i) {
+        const Point& p = coords[i];
+        for (auto it = std::lower_bound(sorted.begin(), sorted.end(), p, less);
+             it != sorted.end() && points[*it].x == p.x && points[*it].y == p.y; ++it) {
+            if (!used[*it]) {
+                used[*it] = 1;
+                matched[i] = *it;
+                break;
+            }
+        }
+    }
+    return matched;
+}
+
+// Insère au moindre coût les nœuds absents de la tournée, entre deux nœuds consécutifs
+// dont l'un est candidat du nœud inséré (tous les nœuds de la tournée à défaut)
+void WarmStart::insertMissing(std::vector<int>& succ, std::vector<int>& pred, int& first,
+                              std::vector<char>& changed) {
+    int dimension = graph_.getDimension();
+    const CandidateSet& candidates = graph_.getCandidates();
+    std::vector<int> members; // Nœuds déjà dans la tournée (recherche exhaustive)
+    for (int node = 0; node < dimension; ++node) {
+        if (succ[node] >= 0) {
+            members.push_back(node);
+        }
+    }
+
+    for (int v = 0; v < dimension; ++v) {
+        if (succ[v] >= 0) {
+            continue;
+        }
+        ++insertedCount_;
+        changed[v] = 1;
+        if (first < 0) {
+            // Tournée vide : v seul
+            succ[v] = pred[v] = first = v;
+            members.push_back(v);
+            continue;
+        }
+        long best_delta = std::numeric_limits<long>::max();
+        int best_a = -1;
+        auto consider = [&](int a) {
+            int b = succ[a];
+            long delta = static_cast<long>(graph_.distance(a, v)) + graph_.distance(v, b) - graph_.distance(a, b);
+            if (delta < best_delta) {
+                best_delta = delta;
+                best_a = a;
+            }
+        };
+        if (!candidates.empty()) {
+            for (const int* c = candidates.begin(v); c != candidates.end(v); ++c) {
+                if (succ[*c] >= 0) {
+                    consider(*c);
+                    consider(pred[*c]);
+                }
+            }
+        }
+        if (best_a < 0) {
+            for (int a : members) {
+                consider(a);
+            }
+        }
+        int b = succ[best_a];
+        succ[best_a] = v;
+        pred[v] = best_a;
+        succ[v] = b;
+        pred[b] = v;
+        changed[best_a] = changed[b] = 1;
+        members.push_back(v);
+    }
+}
+
+// Lit la tournée et l'adapte au graphe
+bool WarmStart::load(const std::string& filename) {
+    TSP_STATS_TIMER(Construction);
+    std::vector<int> ids;
+    std::vector<Point> coords;
+    if (!readTourFile(filename, ids, coords)) {
+        return false;
+    }
+    std::vector<int> matched = matchNodes(ids, coords);
+
+    // Chaînage des nœuds repris, dans l'ordre du fichier ; un trou laissé par des
+    // nœuds retirés marque les deux nœuds repris qui l'entourent
+    int dimension = graph_.getDimension();
+    std::vector<int> succ(dimension, -1);
+    std::vector<int> pred(dimension, -1);
+    std::vector<char> changed(dimension, 0);
+    keptCount_ = droppedCount_ = insertedCount_ = 0;
+    int first = -1;
+    int last = -1;
+    bool gap = false;
+    bool leading_gap = false;
+    for (int node : matched) {
+        if (node < 0) {
+            ++droppedCount_;
+            gap = true;
+            continue;
+        }
+        ++keptCount_;
+        if (first < 0) {
+            first = node;
+            leading_gap = gap;
+        } else {
+            succ[last] = node;
+            pred[node] = last;
+            if (gap) {
+                changed[last] = changed[node] = 1;
+            }
+        }
+        gap = false;
+        last = node;
+    }
+    if (first >= 0) {
+        succ[last] = first;
+        pred[first] = last;
+        if (gap || leading_gap) {
+            changed[last] = changed[first] = 1;
+        }
+    }
+
+    insertMissing(succ, pred, first, changed);
+
+    order_.clear();
+    changed_.clear();
+    for (int node = first, i = 0; i < dimension; node = succ[node], ++i) {
+        order_.push_back(node);
+    }
+    for (int node = 0; node < dimension; ++node) {
+        if (changed[node]) {
+            changed_.push_back(node);
+        }
+    }
+    return true;
+}
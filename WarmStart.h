@@ -0,0 +1,56 @@
+#ifndef WARM_START_H
+#define WARM_START_H
+
+#include <string>
+#include <vector>
+
+#include "Geometry.h"
+#include "Graph.h"
+
+// Reprise d'une tournée précédente (fichier .tour écrit par Tour::save) sur une
+// instance légèrement modifiée. Les nœuds sont reconnus par leurs coordonnées
+// (section TOUR_COORDS) quand le fichier et le graphe en ont, sinon par leur numéro.
+// Les nœuds disparus sont retirés, les nouveaux insérés au moindre coût près de
+// leurs candidats ; seuls les nœuds voisins de ces changements sont à réoptimiser.
+class WarmStart {
+public:
+    // Constructeur : prend une référence constante au graphe
+    explicit WarmStart(const Graph& graph);
+
+    // Lit la tournée et l'adapte au graphe. Faux si le fichier est illisible ou ne
+    // contient aucune tournée.
+    bool load(const std::string& filename);
+
+    // Ordre de visite des N nœuds du graphe
+    const std::vector<int>& getOrder() const { return order_; }
+
+    // Nœuds dont le voisinage a changé : nœuds insérés, leurs voisins dans la tournée
+    // et extrémités des trous laissés par les nœuds retirés
+    const std::vector<int>& getChangedNodes() const { return changed_; }
+
+    int getKeptCount() const { return keptCount_; }
+    int getDroppedCount() const { return droppedCount_; }
+    int getInsertedCount() const { return insertedCount_; }
+
+private:
+    const Graph& graph_;
+    std::vector<int> order_;
+    std::vector<int> changed_;
+    int keptCount_ = 0;
+    int droppedCount_ = 0;
+    int insertedCount_ = 0;
+
+    // Lit la séquence des numéros (1-basés) et, si présentes, les coordonnées
+    static bool readTourFile(const std::string& filename, std::vector<int>& ids, std::vector<Point>& coords);
+
+    // Nœud du graphe correspondant à chaque entrée du fichier (-1 : nœud disparu)
+    std::vector<int> matchNodes(const std::vector<int>& ids, const std::vector<Point>& coords) const;
+
+    // Insère au moindre coût les nœuds absents de la tournée succ / pred
+    void insertMissing(std::vector<int>& succ, std::vector<int>& pred, int& first, std::vector<char>& changed);
+
+    WarmStart(const WarmStart&) = delete;
+    WarmStart& operator=(const WarmStart&) = delete;
+};
+
+#endif
@@ -0,0 +1,72 @@
+#include "WorkStealingPool.h"
+#include <thread>
+#include <algorithm> // Pour std::max
+
+#include "Stats.h"
+
+// Constructeur
+WorkStealingPool::WorkStealingPool(int threads) {
+    threads = std::max(1, threads);
+    queues_.reserve(threads);
+    for (int i = 0; i < threads; ++i) {
+        queues_.emplace_back(new Queue());
+    }
+}
+
+// Ajoute une tâche dans la file suivante
+void WorkStealingPool::submit(Task task) {
+    Queue& queue = *queues_[nextQueue_];
+    nextQueue_ = (nextQueue_ + 1) % static_cast<int>(queues_.size());
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.tasks.push_back(std::move(task));
+}
+
+// Prend la prochaine tâche du thread
+// Les tâches n'en soumettent pas d'autres : quand toutes les files sont vides, le lot est terminé.
+bool WorkStealingPool::take(int worker, Task& task) {
+    {
+        Queue& own = *queues_[worker];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.front());
+            own.tasks.pop_front();
+            return true;
+        }
+    }
+    int count = static_cast<int>(queues_.size());
+    for (int offset = 1; offset < count; ++offset) {
+        Queue& victim = *queues_[(worker + offset) % count];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.back());
+            victim.tasks.pop_back();
+            return true;
+        }
+    }
+    return false;
+}
+
+// Boucle d'un thread
+void WorkStealingPool::work(int worker) {
+    Task task;
+    while (take(worker, task)) {
+        task(worker);
+    }
+}
+
+// Exécute toutes les tâches soumises
+void WorkStealingPool::run() {
+    std::vector<std::thread> pool;
+    pool.reserve(queues_.size() - 1);
+    for (int worker = 1; worker < static_cast<int>(queues_.size()); ++worker) {
+        pool.emplace_back([this, worker]() {
+            work(worker);
+            Stats::flushThread(); // Les compteurs du thread disparaissent avec lui
+        });
+    }
+    work(0);
+    for (std::thread& thread : pool) {
+        thread.join();
+    }
+    nextQueue_ = 0;
+}
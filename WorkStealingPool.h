@@ -0,0 +1,49 @@
+#ifndef WORK_STEALING_POOL_H
+#define WORK_STEALING_POOL_H
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Réserve de threads à vol de tâches, pour des lots de tâches indépendantes de
+// durées très inégales (résolution de nombreuses instances).
+// Chaque thread a sa propre file : il prend ses tâches par l'avant et, quand elle
+// est vide, vole les tâches d'une autre file par l'arrière. Soumises de la plus
+// longue à la plus courte, les grosses tâches partent en premier et les vols en
+// fin de lot ne portent que sur de petites tâches.
+class WorkStealingPool {
+public:
+    // Tâche : reçoit l'identifiant du thread qui l'exécute (0..threads-1)
+    using Task = std::function<void(int worker)>;
+
+    // Constructeur : nombre de threads (au moins 1)
+    explicit WorkStealingPool(int threads);
+
+    // Ajoute une tâche ; les files sont remplies à tour de rôle
+    void submit(Task task);
+
+    // Exécute toutes les tâches soumises et rend la main quand elles sont terminées
+    // (le thread appelant est le thread 0)
+    void run();
+
+    int getThreadCount() const { return static_cast<int>(queues_.size()); }
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    int nextQueue_ = 0;
+
+    // Prend la prochaine tâche du thread (sa file, puis vol) ; faux si tout est vide
+    bool take(int worker, Task& task);
+
+    // Boucle d'un thread
+    void work(int worker);
+};
+
+#endif
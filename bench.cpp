@@ -0,0 +1,297 @@
+// Banc de mesure du solveur : chronomètre chaque phase (parsing, matrice, candidats,
+// construction, 2-opt, Or-opt) sur des instances TSPLIB ou générées, et écrit les
+// résultats en JSON sur la sortie standard (un objet par instance).
+// Chaque instance est traitée dans un processus fils : la mémoire maximale (RSS)
+// mesurée est celle de cette seule instance.
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <memory>
+#include <cstdio>    // Pour std::remove
+#include <cstdlib>   // Pour std::exit
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "TsplibParser.h"
+#include "Graph.h"
+#include "TspSolver.h"
+#include "Parallel.h"
+#include "InstanceGenerator.h"
+
+// Longueurs optimales connues (TSPLIB), indexées par nom de fichier sans extension
+static const struct {
+    const char* name;
+    int optimum;
+} kKnownOptima[] = {
+    {"att48", 10628},
+    {"bayg29", 1610},
+};
+
+// Options communes à toutes les instances
+struct BenchOptions {
+    int threads = 0;      // 0 : threads matériels
+    int candidates = 10;
+    unsigned seed = 1;
+    TspSolver::Construction construction = TspSolver::Construction::NearestNeighbor;
+    bool bestTwoOpt = false; // 2-opt exhaustif en meilleure amélioration (--two-opt=best)
+};
+
+// Instance à mesurer : fichier existant, ou générée (dimension > 0)
+struct BenchInstance {
+    std::string filename;
+    int generatedDimension = 0;
+};
+
+// Millisecondes écoulées depuis start
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Nom d'un fichier sans répertoire ni extension
+static std::string baseName(const std::string& filename) {
+    std::string name = filename.substr(filename.find_last_of('/') + 1);
+    return name.substr(0, name.find('.'));
+}
+
+// Chaîne JSON (les noms de fichiers peuvent contenir des guillemets ou des barres obliques inverses)
+static std::string jsonString(const std::string& value) {
+    std::string result = "\"";
+    for (char c : value) {
+        if (c == '"' || c == '\\') {
+            result += '\\';
+        }
+        result += c;
+    }
+    return result + "\"";
+}
+
+// Mesure une instance ; retourne l'objet JSON correspondant
+static std::string benchInstance(const std::string& filename, const BenchOptions& options) {
+    std::ostringstream json;
+    json.setf(std::ios::fixed);
+    json.precision(3);
+    json << "{\"instance\": " << jsonString(baseName(filename));
+
+    int threads = options.threads > 0 ? options.threads : hardwareThreads();
+    auto total_start = std::chrono::steady_clock::now();
+
+    // 1. Parsing (la matrice est construite séparément)
+    auto start = std::chrono::steady_clock::now();
+    TsplibParser parser(filename);
+    parser.setDeferDistanceMatrix(true);
+    parser.setThreadCount(threads);
+    if (!parser.parse()) {
+        json << ", \"error\": \"parse\"}";
+        return json.str();
+    }
+    double parse_ms = elapsedMs(start);
+    int dimension = parser.getDimension();
+
+    // 2. Matrice de distances (remplie pendant le parsing pour EXPLICIT)
+    start = std::chrono::steady_clock::now();
+    std::unique_ptr<Graph> graph;
+    // Même choix que le mode automatique de tsp_solver
+    bool use_coordinates = parser.hasCoordinates() && exceedsAutoMatrixBudget(dimension, parser.getMatrixLayout());
+    if (use_coordinates) {
+        graph.reset(new Graph(parser.takeNodeCoords(), parser.getCoordMetric()));
+    } else {
+        if (parser.hasCoordinates() && !parser.buildDistanceMatrix()) {
+            json << ", \"error\": \"matrix\"}";
+            return json.str();
+        }
+        bool has_coordinates = parser.hasCoordinates();
+        graph.reset(new Graph(dimension, parser.takeDistanceMatrix(), parser.getMatrixLayout()));
+        graph->narrowWeights();
+        if (has_coordinates) {
+            graph->setNodeCoords(parser.takeNodeCoords());
+        }
+    }
+    double matrix_ms = elapsedMs(start);
+
+    // 3. Listes de candidats
+    start = std::chrono::steady_clock::now();
+    if (options.candidates > 0) {
+        graph->buildCandidateLists(options.candidates);
+    }
+    double candidates_ms = elapsedMs(start);
+
+    // 4. Construction (heuristique choisie, multi-départ du plus proche voisin par défaut), puis 2-opt et Or-opt
+    TspSolver solver(*graph);
+    solver.setThreadCount(threads);
+    solver.setSeed(options.seed);
+    solver.setConstruction(options.construction);
+    start = std::chrono::steady_clock::now();
+    Tour tour = solver.constructStartTours().front();
+    double construction_ms = elapsedMs(start);
+    long construction_length = tour.getTotalDistance();
+
+    start = std::chrono::steady_clock::now();
+    tour = options.bestTwoOpt ? solver.OptimizationBestTwoOpt(tour) : solver.OptimizationSwapEdges(tour);
+    double two_opt_ms = elapsedMs(start);
+    long two_opt_length = tour.getTotalDistance();
+
+    start = std::chrono::steady_clock::now();
+    tour = solver.OptimizationMoveSegments(tour);
+    double or_opt_ms = elapsedMs(start);
+    double total_ms = elapsedMs(total_start);
+
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+
+    json << ", \"dimension\": " << dimension
+         << ", \"distance_mode\": \"" << (use_coordinates ? "coords" : "matrix") << "\""
+         << ", \"weight_bytes\": " << (use_coordinates ? 0 : weightSize(graph->getWeightType()))
+         << ", \"threads\": " << threads
+         << ", \"construction_heuristic\": \"" << TspSolver::constructionName(options.construction) << "\""
+         << ", \"two_opt_mode\": \"" << (options.bestTwoOpt ? "best" : "first") << "\""
+         << ", \"phases_ms\": {\"parse\": " << parse_ms
+         << ", \"matrix\": " << matrix_ms
+         << ", \"candidates\": " << candidates_ms
+         << ", \"construction\": " << construction_ms
+         << ", \"two_opt\": " << two_opt_ms
+         << ", \"or_opt\": " << or_opt_ms << "}"
+         << ", \"total_ms\": " << total_ms
+         << ", \"peak_rss_kb\": " << usage.ru_maxrss
+         << ", \"lengths\": {\"construction\": " << construction_length
+         << ", \"two_opt\": " << two_opt_length
+         << ", \"or_opt\": " << tour.getTotalDistance() << "}";
+
+    int optimum = 0;
+    for (const auto& known : kKnownOptima) {
+        if (baseName(filename) == known.name) {
+            optimum = known.optimum;
+        }
+    }
+    if (optimum > 0) {
+        json << ", \"optimum\": " << optimum
+             << ", \"gap_percent\": " << 100.0 * (tour.getTotalDistance() - optimum) / optimum;
+    } else {
+        json << ", \"optimum\": null, \"gap_percent\": null";
+    }
+    json << "}";
+    return json.str();
+}
+
+// Mesure une instance dans un processus fils ; le JSON revient par un tube
+static std::string benchInChild(const std::string& filename, const BenchOptions& options) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        return benchInstance(filename, options); // Repli : mesure dans ce processus
+    }
+    std::cout.flush();
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(fds[0]);
+        std::string json = benchInstance(filename, options);
+        ssize_t written = write(fds[1], json.data(), json.size());
+        close(fds[1]);
+        std::exit(written == static_cast<ssize_t>(json.size()) ? 0 : 1);
+    }
+    close(fds[1]);
+    std::string json;
+    char buffer[4096];
+    ssize_t count;
+    while ((count = read(fds[0], buffer, sizeof(buffer))) > 0) {
+        json.append(buffer, static_cast<std::size_t>(count));
+    }
+    close(fds[0]);
+    int status = 0;
+    if (pid > 0) {
+        waitpid(pid, &status, 0);
+    }
+    if (pid < 0 || json.empty()) {
+        return "{\"instance\": " + jsonString(baseName(filename)) + ", \"error\": \"crash\"}";
+    }
+    return json;
+}
+
+// Affiche l'aide de la ligne de commande
+static void printUsage(const char* program) {
+    std::cerr << "Utilisation: " << program << " [fichier.tsp ...] [options]" << std::endl;
+    std::cerr << "Options :" << std::endl;
+    std::cerr << "  --generate=N     Ajoute une instance aléatoire EUC_2D de N nœuds" << std::endl;
+    std::cerr << "  --threads=N      Nombre de threads (défaut : tous les cœurs)" << std::endl;
+    std::cerr << "  --candidates=K   Nombre de candidats par nœud (défaut : 10)" << std::endl;
+    std::cerr << "  --seed=S         Graine (instances générées et départs)" << std::endl;
+    std::cerr << "  --construction=nearest|greedy|hilbert|christofides  Tournée de départ (défaut : nearest)" << std::endl;
+    std::cerr << "  --two-opt=first|best  2-opt sur les candidats (défaut) ou exhaustif en meilleure amélioration" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    std::vector<BenchInstance> instances;
+    for (int arg_index = 1; arg_index < argc; ++arg_index) {
+        std::string arg = argv[arg_index];
+        if (arg.compare(0, 2, "--") != 0) {
+            instances.push_back(BenchInstance{arg, 0});
+            continue;
+        }
+        size_t separator = arg.find('=');
+        std::string name = arg.substr(0, separator);
+        if (name == "--construction") {
+            if (!TspSolver::parseConstruction(arg.substr(separator + 1), options.construction)) {
+                std::cerr << "Heuristique de construction inconnue : " << arg << std::endl;
+                printUsage(argv[0]);
+                return 1;
+            }
+            continue;
+        }
+        if (arg == "--two-opt=first" || arg == "--two-opt=best") {
+            options.bestTwoOpt = (arg == "--two-opt=best");
+            continue;
+        }
+        long value = -1;
+        if (separator != std::string::npos) {
+            try {
+                value = std::stol(arg.substr(separator + 1));
+            } catch (const std::exception&) {
+                value = -1;
+            }
+        }
+        if (value < 0 || (name == "--generate" && value < 2)) {
+            std::cerr << "Argument invalide : " << arg << std::endl;
+            printUsage(argv[0]);
+            return 1;
+        }
+        if (name == "--generate") {
+            instances.push_back(BenchInstance{"bench_random_" + std::to_string(value) + ".tsp", static_cast<int>(value)});
+        } else if (name == "--threads") {
+            options.threads = static_cast<int>(value);
+        } else if (name == "--candidates") {
+            options.candidates = static_cast<int>(value);
+        } else if (name == "--seed") {
+            options.seed = static_cast<unsigned>(value);
+        } else {
+            std::cerr << "Argument inconnu : " << arg << std::endl;
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (instances.empty()) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    std::cout << "[" << std::endl;
+    for (size_t i = 0; i < instances.size(); ++i) {
+        const BenchInstance& instance = instances[i];
+        std::string json;
+        if (instance.generatedDimension > 0 &&
+            !InstanceGenerator(instance.generatedDimension, Distribution::Uniform, options.seed).write(instance.filename)) {
+            json = "{\"instance\": " + jsonString(baseName(instance.filename)) + ", \"error\": \"generate\"}";
+        } else {
+            json = benchInChild(instance.filename, options);
+        }
+        if (instance.generatedDimension > 0) {
+            std::remove(instance.filename.c_str());
+        }
+        std::cout << "  " << json << (i + 1 < instances.size() ? "," : "") << std::endl;
+    }
+    std::cout << "]" << std::endl;
+    return 0;
+}
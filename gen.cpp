@@ -0,0 +1,79 @@
+// Générateur d'instances : écrit une instance TSPLIB EUC_2D synthétique
+// (points uniformes, en nuages ou en grille) dans un fichier ou sur la sortie standard.
+
+#include <iostream>
+#include <string>
+
+#include "InstanceGenerator.h"
+
+// Affiche l'aide de la ligne de commande
+static void printUsage(const char* program) {
+    std::cerr << "Utilisation: " << program << " <fichier.tsp | -> --nodes=N [options]" << std::endl;
+    std::cerr << "Options :" << std::endl;
+    std::cerr << "  --nodes=N                          Nombre de nœuds" << std::endl;
+    std::cerr << "  --distribution=uniform|clustered|grid  Répartition des points (défaut : uniform)" << std::endl;
+    std::cerr << "  --clusters=C                       Nombre de nuages (défaut : N / 1000)" << std::endl;
+    std::cerr << "  --range=R                          Coordonnées dans [0, R) (défaut : 1000000)" << std::endl;
+    std::cerr << "  --seed=S                           Graine du générateur (défaut : 1)" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    std::string filename;
+    long nodes = 0;
+    long clusters = 0;
+    long range = 1000000;
+    long seed = 1;
+    Distribution distribution = Distribution::Uniform;
+
+    for (int arg_index = 1; arg_index < argc; ++arg_index) {
+        std::string arg = argv[arg_index];
+        if (arg.compare(0, 2, "--") != 0) {
+            filename = arg;
+            continue;
+        }
+        size_t separator = arg.find('=');
+        std::string name = arg.substr(0, separator);
+        std::string text = separator != std::string::npos ? arg.substr(separator + 1) : "";
+        if (name == "--distribution") {
+            if (!InstanceGenerator::parseDistribution(text, distribution)) {
+                std::cerr << "Répartition inconnue : " << text << std::endl;
+                printUsage(argv[0]);
+                return 1;
+            }
+            continue;
+        }
+        long value = -1;
+        try {
+            value = std::stol(text);
+        } catch (const std::exception&) {
+            value = -1;
+        }
+        if (value < 0 || value > 2000000000L) {
+            std::cerr << "Argument invalide : " << arg << std::endl;
+            printUsage(argv[0]);
+            return 1;
+        }
+        if (name == "--nodes") {
+            nodes = value;
+        } else if (name == "--clusters") {
+            clusters = value;
+        } else if (name == "--range") {
+            range = value;
+        } else if (name == "--seed") {
+            seed = value;
+        } else {
+            std::cerr << "Argument inconnu : " << arg << std::endl;
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (filename.empty() || nodes < 2 || range < 1) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    InstanceGenerator generator(static_cast<int>(nodes), distribution, static_cast<unsigned long>(seed));
+    generator.setClusterCount(static_cast<int>(clusters));
+    generator.setRange(range);
+    return generator.write(filename) ? 0 : 1;
+}
@@ -1,102 +1,697 @@
 #include <iostream>
 #include <string>
 #include <vector>
+#include <memory>
 #include <fstream> // Pour l'écriture de fichiers
 #include <limits>  // Pour std::numeric_limits
+#include <algorithm> // Pour std::min, std::sort
+#include <chrono>
+#include <mutex>
+#include <cmath>   // Pour std::floor
+
+#include <dirent.h>   // Pour le parcours des répertoires (mode lot)
+#include <sys/stat.h>
 
 #include "TsplibParser.h"
 #include "Graph.h"
 #include "TspSolver.h"
 #include "Tour.h"
+#include "InstanceCache.h"
+#include "Stats.h"
+#include "Parallel.h"
+#include "WorkStealingPool.h"
+#include "HeldKarpBound.h"
+#include "WarmStart.h"
+#include "Decomposition.h"
+
+// Mode lot : à partir de cette dimension, une instance est résolue seule avec tous les
+// threads ; les plus petites sont regroupées, un thread chacune, sur la réserve à vol de tâches
+static const int kBatchParallelThreshold = 5000;
+
+// Options de chargement et de résolution, communes au mode fichier unique et au mode lot
+struct RunOptions {
+    MatrixLayout layout = MatrixLayout::Full;
+    std::string distanceMode = "auto";
+    int candidateCount = 10;
+    TspSolver::Engine engine = TspSolver::Engine::Local;
+    TspSolver::Construction construction = TspSolver::Construction::NearestNeighbor;
+    int threadCount = 0; // 0 : valeur par défaut du solveur
+    int startCount = 0;
+    int topK = 1;
+    unsigned long seed = 1;
+    bool useCache = false;
+    double timeLimit = 0.0;
+    long iterationLimit = 0;
+    bool narrowWeights = true; // Matrice en uint16 / uint8 quand les poids le permettent
+    bool computeBound = false;   // Borne inférieure de Held-Karp
+    double targetGap = -1.0;     // Écart à la borne (en %) qui arrête la recherche (< 0 : aucun)
+    bool alphaCandidates = false; // Candidats choisis par α-proximité
+    int exactLimit = TspSolver::kDefaultExactLimit; // Dimension maximale de la résolution exacte
+    bool warmStart = false;      // Reprend la tournée précédente (<fichier>.tour par défaut)
+    std::string warmStartFile;   // Tournée reprise en mode fichier unique (vide : <fichier>.tour)
+    int clusterSize = 0;         // Décomposition géométrique au-delà de cette dimension (0 : jamais)
+};
+
+// Résultat d'une instance du mode lot
+struct BatchResult {
+    int dimension = 0;
+    int threads = 0;
+    long length = -1;
+    long lowerBound = -1; // -1 : borne non calculée
+    bool optimal = false; // Tournée prouvée optimale
+    double timeMs = 0.0;
+    std::string error; // Vide si l'instance a été résolue
+};
+
+// Affiche l'aide de la ligne de commande
+static void printUsage(const char* program) {
+    std::cerr << "Utilisation: " << program << " <chemin_vers_fichier_tsplib> [options]" << std::endl;
+    std::cerr << "             " << program << " --batch <fichiers.tsp | répertoires> [options]" << std::endl;
+    std::cerr << "Options :" << std::endl;
+    std::cerr << "  --debug                       Affiche la matrice de distances" << std::endl;
+    std::cerr << "  --triangular                  Ne stocke que le triangle supérieur de la matrice" << std::endl;
+    std::cerr << "  --distance=matrix|coords|auto Matrice précalculée ou distances calculées à la demande" << std::endl;
+    std::cerr << "  --weights=auto|int32          Poids de la matrice sur 8/16 bits si possible, ou toujours 32 bits" << std::endl;
+    std::cerr << "  --candidates=K                Nombre de plus proches voisins candidats (0 : aucun)" << std::endl;
+    std::cerr << "  --engine=local|lk|best        Moteur : 2-opt/Or-opt, Lin-Kernighan ou 2-opt exhaustif" << std::endl;
+    std::cerr << "  --construction=nearest|greedy|hilbert|christofides  Heuristique de la tournée de départ" << std::endl;
+    std::cerr << "  --threads=N                   Nombre de threads (défaut : tous les cœurs)" << std::endl;
+    std::cerr << "  --starts=N                    Nombre de départs tirés au hasard (défaut : tous les nœuds)" << std::endl;
+    std::cerr << "  --top-k=K                     Nombre de meilleures tournées de départ améliorées" << std::endl;
+    std::cerr << "  --seed=S                      Graine du générateur pseudo-aléatoire" << std::endl;
+    std::cerr << "  --cache                       Lit ou écrit le cache binaire <fichier>.cache" << std::endl;
+    std::cerr << "  --time-limit=SECONDES         Recherche locale itérée jusqu'à ce délai" << std::endl;
+    std::cerr << "  --iterations=N                Nombre maximal de perturbations de la recherche itérée" << std::endl;
+    std::cerr << "  --bound                       Calcule la borne inférieure de Held-Karp et l'écart à celle-ci" << std::endl;
+    std::cerr << "  --target-gap=P                Arrête la recherche à P % de la borne (implique --bound)" << std::endl;
+    std::cerr << "  --alpha-candidates            Candidats choisis par α-proximité (implique --bound)" << std::endl;
+    std::cerr << "  --exact-limit=N               Résolution exacte jusqu'à N nœuds (défaut : " << TspSolver::kDefaultExactLimit
+              << ", 0 : jamais)" << std::endl;
+    std::cerr << "  --decompose[=N]               Grappes d'au plus N nœuds résolues en parallèle (défaut : "
+              << Decomposition::kDefaultClusterSize << ")" << std::endl;
+    std::cerr << "  --warm-start[=FICHIER]        Reprend une tournée précédente (défaut : <fichier>.tour)" << std::endl;
+    std::cerr << "  --stats[=json]                Affiche temps par phase et compteurs (texte ou JSON)" << std::endl;
+    std::cerr << "  --summary=FICHIER             Résumé JSON du mode lot (défaut : batch_summary.json)" << std::endl;
+}
+
+// Choisit le mode de distance : les instances EXPLICIT n'ont pas de coordonnées
+static bool chooseCoordinates(bool hasCoordinates, int dimension, const std::string& distanceMode,
+                              MatrixLayout layout) {
+    if (hasCoordinates) {
+        return distanceMode == "coords" || (distanceMode == "auto" && exceedsAutoMatrixBudget(dimension, layout));
+    }
+    if (distanceMode == "coords") {
+        std::cerr << "Avertissement: Instance sans coordonnées, utilisation de la matrice de distances." << std::endl;
+    }
+    return false;
+}
+
+// Lit l'instance (cache binaire s'il est à jour, sinon fichier TSPLIB) et construit le
+// graphe et ses listes de candidats ; nullptr en cas d'échec.
+// threads : threads de construction de la matrice (0 : threads matériels).
+static std::unique_ptr<Graph> loadGraph(const std::string& filename, const RunOptions& options, int threads,
+                                        bool verbose) {
+    // 1. Lire l'instance : depuis le cache binaire s'il est à jour, sinon parser le fichier TSPLIB
+    InstanceCache cache;
+    std::string cache_path = InstanceCache::sidecarPath(filename);
+    bool cache_loaded = options.useCache && cache.open(cache_path, filename);
+    bool use_coordinates = false;
+    bool cache_narrowed = false;
+    if (cache_loaded) {
+        use_coordinates = chooseCoordinates(cache.hasCoordinates(), cache.getDimension(), options.distanceMode,
+                                            options.layout);
+        if (!use_coordinates && !cache.hasMatrix(options.layout)) {
+            cache_loaded = false; // Matrice absente ou dans une autre disposition
+        } else if (!use_coordinates && !options.narrowWeights && cache.getWeightType() != WeightType::Int32) {
+            cache_loaded = false; // Poids réduits alors que --weights=int32 : matrice relue, cache réécrit
+        }
+    }
+
+    TsplibParser parser(filename);
+    int dimension = 0;
+    bool has_coordinates = false;
+    CoordMetric metric = CoordMetric::Euc2d;
+    if (cache_loaded) {
+        if (verbose) {
+            std::cout << "Instance chargée depuis le cache : " << cache_path << std::endl;
+        }
+        dimension = cache.getDimension();
+        has_coordinates = cache.hasCoordinates();
+        metric = cache.getCoordMetric();
+    } else {
+        parser.setMatrixLayout(options.layout);
+        // La matrice n'est construite qu'une fois le mode de distance choisi
+        parser.setDeferDistanceMatrix(true);
+        if (threads > 0) {
+            parser.setThreadCount(threads);
+        }
+
+        if (verbose) {
+            std::cout << "Tentative de parsing du fichier : " << filename << std::endl;
+        }
+
+        if (!parser.parse()) {
+            std::cerr << "Erreur lors du parsing du fichier TSPLIB " << filename << "." << std::endl;
+            return nullptr;
+        }
+
+        if (verbose) {
+            std::cout << "Parsing réussi !" << std::endl;
+        }
+        dimension = parser.getDimension();
+        has_coordinates = parser.hasCoordinates();
+        metric = parser.getCoordMetric();
+        use_coordinates = chooseCoordinates(has_coordinates, dimension, options.distanceMode, options.layout);
+    }
+
+    // 2. Créer un objet Graph à partir des données lues
+    if (dimension <= 0) {
+        std::cerr << "Erreur: Les données du graphe ne sont pas valides après parsing." << std::endl;
+        return nullptr;
+    }
+
+    std::unique_ptr<Graph> graph_ptr;
+    if (use_coordinates) {
+        // Seules les coordonnées sont conservées : mémoire en O(N)
+        graph_ptr.reset(new Graph(cache_loaded ? cache.getNodeCoords() : parser.takeNodeCoords(), metric));
+    } else if (cache_loaded) {
+        // La matrice est lue directement dans le fichier projeté (pas de copie)
+        graph_ptr = cache.createMatrixGraph();
+        // Cache écrit avec --weights=int32 : poids réduits ici, puis cache réécrit
+        if (options.narrowWeights && graph_ptr->narrowWeights()) {
+            cache_narrowed = true;
+        }
+        if (has_coordinates) {
+            graph_ptr->setNodeCoords(cache.getNodeCoords());
+        }
+    } else {
+        if (has_coordinates && !parser.buildDistanceMatrix()) {
+            return nullptr;
+        }
+        if (parser.getDistanceMatrix().empty()) {
+            std::cerr << "Erreur: Les données du graphe ne sont pas valides après parsing." << std::endl;
+            return nullptr;
+        }
+        // La matrice est déplacée du parser vers le graphe (pas de copie)
+        graph_ptr.reset(new Graph(dimension, parser.takeDistanceMatrix(), options.layout));
+        if (options.narrowWeights) {
+            graph_ptr->narrowWeights();
+        }
+        if (has_coordinates) {
+            // Les coordonnées restent utiles aux structures géométriques (arbre k-d)
+            graph_ptr->setNodeCoords(parser.takeNodeCoords());
+        }
+    }
+
+    // Listes de candidats : les heuristiques se limitent aux k plus proches voisins
+    // (reprises du cache quand il en contient le même nombre)
+    bool cache_complete = cache_loaded && !cache_narrowed;
+    if (options.candidateCount > 0) {
+        int k = std::min(options.candidateCount, dimension - 1);
+        if (cache_loaded && cache.getCandidateK() == k) {
+            graph_ptr->setCandidates(cache.getCandidates());
+        } else {
+            graph_ptr->buildCandidateLists(options.candidateCount);
+            cache_complete = false;
+        }
+    }
+    if (options.useCache && !cache_complete) {
+        if (InstanceCache::write(cache_path, filename, *graph_ptr, has_coordinates, metric) && verbose) {
+            std::cout << "Cache écrit : " << cache_path << std::endl;
+        }
+    }
+    return graph_ptr;
+}
+
+// Calcule la borne de Held-Karp si elle est demandée et, sur option, remplace les listes
+// de candidats par les α-proximités ; -1 si la borne n'est pas calculée
+static long computeLowerBound(Graph& graph, const RunOptions& options, int threads, bool verbose) {
+    if (!options.computeBound) {
+        return -1;
+    }
+    HeldKarpBound bound(graph);
+    if (!bound.compute()) {
+        return -1;
+    }
+    if (options.alphaCandidates && options.candidateCount > 0) {
+        CandidateSet candidates = bound.alphaCandidates(options.candidateCount, threads > 0 ? threads : hardwareThreads());
+        if (!candidates.empty()) {
+            graph.setCandidates(std::move(candidates));
+        } else if (verbose) {
+            std::cerr << "Avertissement: α-proximités indisponibles au-delà de " << HeldKarpBound::kDenseLimit
+                      << " nœuds, candidats géométriques conservés." << std::endl;
+        }
+    }
+    if (verbose) {
+        std::cout << "Borne inférieure (Held-Karp) : " << bound.getLowerBound()
+                  << (bound.isValidated() ? "" : " (estimée sur les candidats)")
+                  << (bound.isTourFound() ? ", optimale" : "")
+                  << " (" << bound.getIterations() << " itérations)" << std::endl;
+    }
+    return bound.getLowerBound();
+}
+
+// Résout l'instance avec les options données (threads : 0 pour la valeur par défaut du solveur).
+// lowerBound : borne inférieure (-1 si inconnue), utilisée par l'écart cible.
+// warmStart : tournée précédente adaptée au graphe (nullptr : construction habituelle).
+// provenOptimal indique si la tournée retournée est prouvée optimale.
+static Tour solveGraph(const Graph& graph, const RunOptions& options, int threads, long lowerBound,
+                       const WarmStart* warmStart, bool& provenOptimal) {
+    TspSolver solver(graph);
+    solver.setEngine(options.engine);
+    solver.setConstruction(options.construction);
+    if (threads > 0) {
+        solver.setThreadCount(threads);
+    }
+    solver.setStartSampleSize(options.startCount);
+    solver.setTopK(options.topK);
+    solver.setSeed(static_cast<unsigned>(options.seed));
+    solver.setTimeLimit(options.timeLimit);
+    solver.setIterationLimit(options.iterationLimit);
+    if (options.targetGap >= 0.0 && lowerBound > 0) {
+        solver.setTargetLength(static_cast<long>(std::floor(lowerBound * (1.0 + options.targetGap / 100.0))));
+    }
+    solver.setExactLimit(options.exactLimit);
+    solver.setClusterSize(options.clusterSize);
+    if (warmStart) {
+        solver.setWarmStart(warmStart->getOrder(), warmStart->getChangedNodes());
+    }
+    Tour tour = solver.solve();
+    provenOptimal = solver.isProvenOptimal();
+    return tour;
+}
+
+// Ajoute à files les chemins donnés ; un répertoire apporte ses fichiers .tsp (triés par nom)
+static bool collectBatchFiles(const std::vector<std::string>& paths, std::vector<std::string>& files) {
+    for (const std::string& path : paths) {
+        struct stat info;
+        if (::stat(path.c_str(), &info) != 0) {
+            std::cerr << "Erreur: Chemin introuvable : " << path << std::endl;
+            return false;
+        }
+        if (!S_ISDIR(info.st_mode)) {
+            files.push_back(path);
+            continue;
+        }
+        DIR* directory = ::opendir(path.c_str());
+        if (!directory) {
+            std::cerr << "Erreur: Impossible de lire le répertoire " << path << std::endl;
+            return false;
+        }
+        std::vector<std::string> entries;
+        while (struct dirent* entry = ::readdir(directory)) {
+            std::string name = entry->d_name;
+            if (name.size() > 4 && name.compare(name.size() - 4, 4, ".tsp") == 0) {
+                entries.push_back(path + (path.back() == '/' ? "" : "/") + name);
+            }
+        }
+        ::closedir(directory);
+        std::sort(entries.begin(), entries.end());
+        files.insert(files.end(), entries.begin(), entries.end());
+    }
+    return true;
+}
+
+// Chaîne JSON (les chemins peuvent contenir des guillemets ou des barres obliques inverses)
+static std::string jsonString(const std::string& value) {
+    std::string result = "\"";
+    for (char c : value) {
+        if (c == '"' || c == '\\') {
+            result += '\\';
+        }
+        result += c;
+    }
+    return result + "\"";
+}
+
+// Mode lot : résout toutes les instances dans ce processus et écrit un résumé JSON.
+// Les dimensions sont lues dans les en-têtes pour ordonner le lot : les grandes
+// instances passent d'abord, une à la fois avec tous les threads ; les petites sont
+// ensuite réparties, de la plus grande à la plus petite, sur une réserve à vol de
+// tâches où chacune est résolue par un seul thread.
+static int runBatch(const std::vector<std::string>& files, const RunOptions& options, const std::string& summaryPath) {
+    int count = static_cast<int>(files.size());
+    int threads = options.threadCount > 0 ? options.threadCount : hardwareThreads();
+    std::vector<BatchResult> results(count);
+    parallelFor(count, threads, [&](int index, int) {
+        results[index].dimension = TsplibParser::readDimension(files[index]);
+    });
+
+    std::vector<int> order(count);
+    for (int i = 0; i < count; ++i) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&results](int a, int b) {
+        return results[a].dimension > results[b].dimension;
+    });
+
+    std::mutex output_mutex;
+    int done = 0;
+    auto solveOne = [&](int index, int instanceThreads) {
+        BatchResult& result = results[index];
+        result.threads = instanceThreads;
+        auto start = std::chrono::steady_clock::now();
+        std::unique_ptr<Graph> graph = loadGraph(files[index], options, instanceThreads, false);
+        if (!graph) {
+            result.error = "load";
+        } else {
+            result.dimension = graph->getDimension();
+            result.lowerBound = computeLowerBound(*graph, options, instanceThreads, false);
+            // Départ à chaud depuis la tournée du lot précédent, si elle existe
+            std::string tour_path = files[index] + ".tour";
+            struct stat info;
+            WarmStart warm_start(*graph);
+            bool warm = options.warmStart && ::stat(tour_path.c_str(), &info) == 0 && warm_start.load(tour_path);
+            Tour tour = solveGraph(*graph, options, instanceThreads, result.lowerBound, warm ? &warm_start : nullptr,
+                                   result.optimal);
+            result.length = tour.getTotalDistance();
+            if (!tour.save(tour_path, graph->getNodeCoords())) {
+                result.error = "write";
+            }
+        }
+        result.timeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        std::lock_guard<std::mutex> lock(output_mutex);
+        ++done;
+        std::cout << "[" << done << "/" << count << "] " << files[index] << " : ";
+        if (result.error.empty()) {
+            std::cout << result.length;
+        } else {
+            std::cout << "échec (" << result.error << ")";
+        }
+        std::cout << " (" << static_cast<long>(result.timeMs) << " ms, " << instanceThreads << " thread"
+                  << (instanceThreads > 1 ? "s" : "") << ")" << std::endl;
+    };
+
+    WorkStealingPool pool(threads);
+    for (int index : order) {
+        if (results[index].dimension >= kBatchParallelThreshold) {
+            solveOne(index, threads);
+        } else {
+            pool.submit([&solveOne, index](int) { solveOne(index, 1); });
+        }
+    }
+    pool.run();
+
+    // Résumé, dans l'ordre des fichiers donnés
+    std::ofstream summary(summaryPath);
+    int failures = 0;
+    summary.setf(std::ios::fixed);
+    summary.precision(3);
+    summary << "[" << "\n";
+    for (int i = 0; i < count; ++i) {
+        const BatchResult& result = results[i];
+        summary << "  {\"instance\": " << jsonString(files[i])
+                << ", \"dimension\": " << result.dimension
+                << ", \"threads\": " << result.threads
+                << ", \"length\": ";
+        if (result.length >= 0) {
+            summary << result.length;
+        } else {
+            summary << "null";
+        }
+        if (result.lowerBound >= 0) {
+            summary << ", \"lower_bound\": " << result.lowerBound;
+            if (result.length >= 0) {
+                summary << ", \"gap_percent\": " << HeldKarpBound::gapPercent(result.length, result.lowerBound);
+            }
+        }
+        summary << ", \"optimal\": " << (result.optimal ? "true" : "false")
+                << ", \"time_ms\": " << result.timeMs
+                << ", \"status\": " << jsonString(result.error.empty() ? "ok" : result.error) << "}"
+                << (i + 1 < count ? "," : "") << "\n";
+        if (!result.error.empty()) {
+            ++failures;
+        }
+    }
+    summary << "]" << "\n";
+    summary.close();
+    if (!summary) {
+        std::cerr << "Erreur: Impossible d'écrire le résumé " << summaryPath << std::endl;
+        return 1;
+    }
+    std::cout << count - failures << "/" << count << " instances résolues ; résumé écrit dans " << summaryPath
+              << std::endl;
+    return failures == 0 ? 0 : 1;
+}
 
 int main(int argc, char* argv[]) {
     // Vérifier le nombre d'arguments
-    if (argc < 2 || argc > 3) {
-        std::cerr << "Utilisation: " << argv[0] << " <chemin_vers_fichier_tsplib> [--debug]" << std::endl;
+    if (argc < 2) {
+        printUsage(argv[0]);
         return 1; // Quitter avec un code d'erreur
     }
 
-    // Récupérer le nom du fichier depuis les arguments
+    // Récupérer le nom du fichier depuis les arguments (ou le mode lot)
     std::string filename = argv[1];
+    bool batch_mode = (filename == "--batch");
+    std::vector<std::string> batch_paths;
 
-    // Vérifier si l'option --debug est présente
+    // Lire les options éventuelles
     bool debug_mode = false;
-    if (argc == 3) {
-        std::string debug_arg = argv[2];
-        if (debug_arg == "--debug") {
+    RunOptions options;
+    std::string stats_format; // Vide : pas de statistiques
+    std::string summary_path = "batch_summary.json";
+    for (int arg_index = 2; arg_index < argc; ++arg_index) {
+        std::string arg = argv[arg_index];
+        if (batch_mode && arg.compare(0, 2, "--") != 0) {
+            batch_paths.push_back(arg);
+        } else if (arg == "--debug") {
             debug_mode = true;
             std::cout << "Mode debug activé. L'affichage de la matrice de distances peut être volumineux." << std::endl;
+        } else if (arg == "--triangular") {
+            // Stockage du seul triangle supérieur : divise la mémoire par deux
+            options.layout = MatrixLayout::UpperTriangle;
+        } else if (arg == "--stats" || arg == "--stats=text") {
+            stats_format = "text";
+        } else if (arg == "--stats=json") {
+            stats_format = "json";
+        } else if (arg == "--cache") {
+            options.useCache = true;
+        } else if (arg == "--weights=auto" || arg == "--weights=int32") {
+            options.narrowWeights = (arg == "--weights=auto");
+        } else if (arg == "--bound") {
+            options.computeBound = true;
+        } else if (arg == "--alpha-candidates") {
+            options.computeBound = true;
+            options.alphaCandidates = true;
+        } else if (arg.compare(0, 13, "--target-gap=") == 0) {
+            try {
+                options.targetGap = std::stod(arg.substr(13));
+            } catch (const std::exception&) {
+                options.targetGap = -1.0;
+            }
+            if (!(options.targetGap >= 0.0)) {
+                std::cerr << "Écart cible invalide : " << arg << std::endl;
+                return 1;
+            }
+            options.computeBound = true;
+        } else if (arg.compare(0, 14, "--exact-limit=") == 0) {
+            try {
+                options.exactLimit = std::stoi(arg.substr(14));
+            } catch (const std::exception&) {
+                options.exactLimit = -1;
+            }
+            if (options.exactLimit < 0) {
+                std::cerr << "Dimension invalide : " << arg << std::endl;
+                return 1;
+            }
+        } else if (arg == "--decompose") {
+            options.clusterSize = Decomposition::kDefaultClusterSize;
+        } else if (arg.compare(0, 12, "--decompose=") == 0) {
+            try {
+                options.clusterSize = std::stoi(arg.substr(12));
+            } catch (const std::exception&) {
+                options.clusterSize = -1;
+            }
+            if (options.clusterSize < 8) {
+                std::cerr << "Taille de grappe invalide (8 au moins) : " << arg << std::endl;
+                return 1;
+            }
+        } else if (arg == "--warm-start") {
+            options.warmStart = true;
+        } else if (arg.compare(0, 13, "--warm-start=") == 0) {
+            if (batch_mode) {
+                std::cerr << "En mode lot, --warm-start reprend <fichier>.tour de chaque instance." << std::endl;
+                return 1;
+            }
+            options.warmStart = true;
+            options.warmStartFile = arg.substr(13);
+        } else if (arg.compare(0, 10, "--summary=") == 0) {
+            summary_path = arg.substr(10);
+        } else if (arg.compare(0, 13, "--time-limit=") == 0) {
+            try {
+                options.timeLimit = std::stod(arg.substr(13));
+            } catch (const std::exception&) {
+                options.timeLimit = -1.0;
+            }
+            if (!(options.timeLimit >= 0.0)) {
+                std::cerr << "Durée invalide : " << arg << std::endl;
+                return 1;
+            }
+        } else if (arg.compare(0, 13, "--iterations=") == 0) {
+            try {
+                options.iterationLimit = std::stol(arg.substr(13));
+            } catch (const std::exception&) {
+                options.iterationLimit = -1;
+            }
+            if (options.iterationLimit < 0) {
+                std::cerr << "Nombre d'itérations invalide : " << arg << std::endl;
+                return 1;
+            }
+        } else if (arg.compare(0, 11, "--distance=") == 0) {
+            options.distanceMode = arg.substr(11);
+            if (options.distanceMode != "matrix" && options.distanceMode != "coords" && options.distanceMode != "auto") {
+                std::cerr << "Mode de distance inconnu : " << options.distanceMode << std::endl;
+                printUsage(argv[0]);
+                return 1;
+            }
+        } else if (arg.compare(0, 13, "--candidates=") == 0) {
+            try {
+                options.candidateCount = std::stoi(arg.substr(13));
+            } catch (const std::exception&) {
+                options.candidateCount = -1;
+            }
+            if (options.candidateCount < 0) {
+                std::cerr << "Nombre de candidats invalide : " << arg << std::endl;
+                return 1;
+            }
+        } else if (arg.compare(0, 15, "--construction=") == 0) {
+            if (!TspSolver::parseConstruction(arg.substr(15), options.construction)) {
+                std::cerr << "Heuristique de construction inconnue : " << arg.substr(15) << std::endl;
+                printUsage(argv[0]);
+                return 1;
+            }
+        } else if (arg == "--engine=local") {
+            options.engine = TspSolver::Engine::Local;
+        } else if (arg == "--engine=lk") {
+            options.engine = TspSolver::Engine::LinKernighan;
+        } else if (arg == "--engine=best") {
+            options.engine = TspSolver::Engine::BestTwoOpt;
+        } else if (arg.compare(0, 10, "--threads=") == 0 || arg.compare(0, 9, "--starts=") == 0 ||
+                   arg.compare(0, 8, "--top-k=") == 0 || arg.compare(0, 7, "--seed=") == 0) {
+            size_t separator = arg.find('=');
+            std::string name = arg.substr(0, separator);
+            long value = -1;
+            try {
+                value = std::stol(arg.substr(separator + 1));
+            } catch (const std::exception&) {
+                value = -1;
+            }
+            if (value < 0 || (name == "--top-k" && value == 0)) {
+                std::cerr << "Valeur invalide : " << arg << std::endl;
+                return 1;
+            }
+            if (name == "--threads") {
+                options.threadCount = static_cast<int>(value);
+            } else if (name == "--starts") {
+                options.startCount = static_cast<int>(value);
+            } else if (name == "--top-k") {
+                options.topK = static_cast<int>(value);
+            } else {
+                options.seed = static_cast<unsigned long>(value);
+            }
         } else {
-            std::cerr << "Argument inconnu : " << debug_arg << std::endl;
-            std::cerr << "Utilisation: " << argv[0] << " <chemin_vers_fichier_tsplib> [--debug]" << std::endl;
+            std::cerr << "Argument inconnu : " << arg << std::endl;
+            printUsage(argv[0]);
             return 1; // Quitter si l'argument inconnu
         }
     }
 
-
-    // 1. Parser le fichier TSPLIB
-    TsplibParser parser(filename);
-
-    std::cout << "Tentative de parsing du fichier : " << filename << std::endl;
-
-    if (!parser.parse()) {
-        std::cerr << "Erreur lors du parsing du fichier TSPLIB. Quitting." << std::endl;
-        return 1; // Quitter si le parsing échoue
+    if (batch_mode) {
+        std::vector<std::string> files;
+        if (!collectBatchFiles(batch_paths, files)) {
+            return 1;
+        }
+        if (files.empty()) {
+            std::cerr << "Erreur: Aucune instance à résoudre." << std::endl;
+            printUsage(argv[0]);
+            return 1;
+        }
+        int status = runBatch(files, options, summary_path);
+        if (stats_format == "json") {
+            Stats::printJson(std::cout);
+        } else if (stats_format == "text") {
+            Stats::print(std::cout);
+        }
+        return status;
     }
 
-    std::cout << "Parsing réussi !" << std::endl;
-
-    // 2. Créer un objet Graph à partir des données parsées
-    int dimension = parser.getDimension();
-    const auto& distanceMatrix = parser.getDistanceMatrix();
-
-    if (dimension <= 0 || distanceMatrix.empty()) {
-        std::cerr << "Erreur: Les données du graphe ne sont pas valides après parsing." << std::endl;
-        return 1;
+    // 1-2. Lire l'instance et créer le graphe
+    std::unique_ptr<Graph> graph_ptr = loadGraph(filename, options, options.threadCount, true);
+    if (!graph_ptr) {
+        std::cerr << "Quitting." << std::endl;
+        return 1; // Quitter si la lecture échoue
     }
+    long lower_bound = computeLowerBound(*graph_ptr, options, options.threadCount, true);
+    const Graph& graph = *graph_ptr;
 
-    Graph graph(dimension, distanceMatrix);
-
-    std::cout << "Graphe créé avec " << graph.getDimension() << " nœuds." << std::endl;
+    std::cout << "Graphe créé avec " << graph.getDimension() << " nœuds";
+    if (graph.getDistanceMode() == DistanceMode::Coordinates) {
+        std::cout << " (distances calculées à la demande)";
+    } else if (graph.getWeightType() != WeightType::Int32) {
+        std::cout << " (poids sur " << 8 * weightSize(graph.getWeightType()) << " bits)";
+    }
+    std::cout << "." << std::endl;
 
     // 3. Afficher la matrice de distances si le mode debug est activé
     if (debug_mode) {
          graph.printDistanceMatrix();
     }
 
-    // 4. Résoudre le TSP en utilisant le TspSolver
+    // 4. Reprendre la tournée précédente (départ à chaud)
+    std::string output_filename = filename + ".tour";
+    WarmStart warm_start(graph);
+    bool warm = false;
+    if (options.warmStart) {
+        std::string warm_path = options.warmStartFile.empty() ? output_filename : options.warmStartFile;
+        warm = warm_start.load(warm_path);
+        if (warm) {
+            std::cout << "Départ à chaud depuis " << warm_path << " : " << warm_start.getKeptCount()
+                      << " nœuds repris, " << warm_start.getDroppedCount() << " retirés, "
+                      << warm_start.getInsertedCount() << " insérés." << std::endl;
+        } else if (!options.warmStartFile.empty()) {
+            std::cerr << "Quitting." << std::endl;
+            return 1;
+        } else {
+            std::cout << "Pas de tournée précédente, départ à froid." << std::endl;
+        }
+    }
+
+    // 5. Résoudre le TSP en utilisant le TspSolver
     std::cout << std::endl << "Résolution du TSP..." << std::endl;
-    TspSolver solver(graph);
-    Tour solution_tour = solver.solve();
+    bool proven_optimal = false;
+    Tour solution_tour = solveGraph(graph, options, options.threadCount, lower_bound, warm ? &warm_start : nullptr,
+                                    proven_optimal);
 
     std::cout << "Résolution terminée." << std::endl;
 
-    // 5. Afficher la solution trouvée
+    // 6. Afficher la solution trouvée
     std::cout << "Solution trouvée :" << std::endl;
     solution_tour.print();
+    if (proven_optimal) {
+        std::cout << "Tournée optimale (prouvée par la résolution exacte)." << std::endl;
+    }
+    if (lower_bound > 0) {
+        std::cout << "Écart à la borne inférieure : " << HeldKarpBound::gapPercent(solution_tour.getTotalDistance(), lower_bound)
+                  << " %" << std::endl;
+    }
 
-    // 6. Sauvegarder la solution dans un fichier
-    std::string output_filename = filename + ".tour";
-
-    std::ofstream outfile(output_filename);
-    if (!outfile.is_open()) {
+    // 7. Sauvegarder la solution dans un fichier
+    if (!solution_tour.save(output_filename, graph.getNodeCoords())) {
         std::cerr << "Erreur: Impossible de créer ou d'ouvrir le fichier de sortie " << output_filename << std::endl;
         // Le programme peut continuer, mais la solution ne sera pas sauvegardée
     } else {
-        // Écrire la solution dans le fichier
-        // Format simple : distance totale, puis séquence des nœuds
-        outfile << "TOUR_DISTANCE : " << solution_tour.getTotalDistance() << std::endl;
-        outfile << "TOUR_NODES :" << std::endl;
-        const auto& nodes = solution_tour.getNodes();
-        for (size_t i = 0; i < nodes.size(); ++i) {
-            outfile << nodes[i] + 1 << std::endl;
-        }
-        outfile << -1 << std::endl; // Marqueur de fin de séquence (convention TSPLIB)
-
-        outfile.close();
         std::cout << "Solution sauvegardée dans " << output_filename << std::endl;
     }
 
 
+    // 8. Statistiques d'exécution
+    if (stats_format == "json") {
+        Stats::printJson(std::cout);
+    } else if (stats_format == "text") {
+        Stats::print(std::cout);
+    }
+
     return 0; // Quitter avec succès
-}
\ No newline at end of file
+}
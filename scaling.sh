@@ -0,0 +1,90 @@
+#!/bin/sh
+# Passage à l'échelle : génère une instance par taille avec tsp_gen, la mesure avec
+# tsp_bench (processus fils : temps par phase et RSS maximale de cette seule instance),
+# puis écrit un tableau N / temps / mémoire et, si gnuplot est disponible, un graphique.
+#
+# Utilisation : ./scaling.sh [tailles...]        (défaut : 1000 10000 100000 1000000)
+# Variables   : DISTRIBUTION=uniform|clustered|grid, SEED=S, THREADS=N,
+#               OUT=préfixe des résultats (défaut : scaling -> scaling.json, .dat, .png)
+
+set -e
+
+SIZES=${*:-"1000 10000 100000 1000000"}
+DISTRIBUTION=${DISTRIBUTION:-uniform}
+SEED=${SEED:-1}
+OUT=${OUT:-scaling}
+THREADS_ARG=""
+if [ -n "$THREADS" ]; then
+    THREADS_ARG="--threads=$THREADS"
+fi
+
+for program in ./tsp_gen ./tsp_bench; do
+    if [ ! -x "$program" ]; then
+        echo "Erreur : $program introuvable (make tsp_gen tsp_bench)" >&2
+        exit 1
+    fi
+done
+
+WORKDIR=$(mktemp -d)
+trap 'rm -rf "$WORKDIR"' EXIT
+
+# Extrait la valeur numérique d'un champ d'une ligne JSON de tsp_bench
+field() {
+    echo "$1" | sed -n "s/.*\"$2\": \([0-9.]*\).*/\1/p"
+}
+
+# Temps d'une phase (objet phases_ms : « construction » figure aussi dans lengths)
+phase() {
+    field "$(echo "$1" | sed -n 's/.*"phases_ms": {\([^}]*\)}.*/\1/p')" "$2"
+}
+
+echo "# N total_ms peak_rss_mb parse_ms candidates_ms construction_ms two_opt_ms or_opt_ms ($DISTRIBUTION, seed $SEED)" > "$OUT.dat"
+echo "[" > "$OUT.json"
+first=1
+for n in $SIZES; do
+    instance="$WORKDIR/${DISTRIBUTION}_$n.tsp"
+    ./tsp_gen "$instance" --nodes="$n" --distribution="$DISTRIBUTION" --seed="$SEED"
+    line=$(./tsp_bench "$instance" --seed="$SEED" $THREADS_ARG | grep '"instance"' | sed 's/^ *//')
+    rm -f "$instance"
+
+    if [ $first -eq 0 ]; then
+        echo "," >> "$OUT.json"
+    fi
+    first=0
+    printf "  %s" "$line" >> "$OUT.json"
+
+    total=$(field "$line" total_ms)
+    if [ -z "$total" ]; then
+        echo "N = $n : échec ($line)" >&2
+        continue
+    fi
+    rss=$(field "$line" peak_rss_kb)
+    rss_mb=$(awk "BEGIN { printf \"%.1f\", $rss / 1024 }")
+    echo "$n $total $rss_mb $(phase "$line" parse) $(phase "$line" candidates)" \
+         "$(phase "$line" construction) $(phase "$line" two_opt) $(phase "$line" or_opt)" >> "$OUT.dat"
+    echo "N = $n : $total ms, $rss_mb Mo"
+done
+printf "\n]\n" >> "$OUT.json"
+
+if command -v gnuplot > /dev/null 2>&1; then
+    gnuplot <<EOF
+set terminal pngcairo size 1200,500
+set output "$OUT.png"
+set multiplot layout 1,2 title "Passage à l'échelle ($DISTRIBUTION)"
+set logscale xy
+set grid
+set xlabel "N"
+set key top left
+set ylabel "temps (ms)"
+plot "$OUT.dat" using 1:2 with linespoints title "total", \
+     "$OUT.dat" using 1:6 with linespoints title "construction", \
+     "$OUT.dat" using 1:7 with linespoints title "2-opt", \
+     "$OUT.dat" using 1:8 with linespoints title "Or-opt"
+set ylabel "RSS maximale (Mo)"
+plot "$OUT.dat" using 1:3 with linespoints title "mémoire"
+unset multiplot
+EOF
+    echo "Graphique : $OUT.png"
+else
+    echo "gnuplot absent : résultats dans $OUT.dat et $OUT.json"
+fi